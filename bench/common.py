@@ -0,0 +1,25 @@
+"""
+Helpers shared by the benchmarks, and by the tests that use bench/server.py.
+"""
+
+import os
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def start_server(*args):
+    """Starts bench/server.py with args, returning the process and its port."""
+    proc = subprocess.Popen([sys.executable, os.path.join(HERE, "server.py")] + [str(a) for a in args],
+                            stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, text=True)
+    port = int(proc.stdout.readline())
+    return proc, port
+
+
+def percentile(values, p):
+    """The pth percentile of values, None if there are none."""
+    if not values:
+        return None
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
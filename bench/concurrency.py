@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+Measures transfers/sec against concurrency for many small files, comparing
+the worker threads (-j) with the event engine (-e).
+
+    bench/concurrency.py [--curler ./curler] [--files 2000] [--size 4096]
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from common import start_server
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def run(curler, flag, n, urlfile, outdir):
+    shutil.rmtree(outdir, ignore_errors=True)
+    os.makedirs(outdir)
+    start = time.monotonic()
+    subprocess.run([curler, flag, str(n), "-p", outdir, "-f", urlfile],
+                   stdout=subprocess.DEVNULL, check=True)
+    return time.monotonic() - start
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    parser.add_argument("--files", type=int, default=2000)
+    parser.add_argument("--size", type=int, default=4096)
+    args = parser.parse_args()
+
+    server, port = start_server()
+    tmp = tempfile.mkdtemp(prefix="curler-bench-")
+    try:
+        urlfile = os.path.join(tmp, "urls.txt")
+        with open(urlfile, "w") as f:
+            for i in range(args.files):
+                f.write("http://127.0.0.1:%d/%d/file%d.bin\n" % (port, args.size, i))
+
+        outdir = os.path.join(tmp, "out")
+        print("%-6s %12s %14s" % ("mode", "concurrency", "transfers/s"))
+        for flag, levels in (("-j", (1, 4, 16, 64)), ("-e", (1, 4, 16, 64, 256, 1024))):
+            for n in levels:
+                secs = run(args.curler, flag, n, urlfile, outdir)
+                print("%-6s %12d %14.0f" % (flag, n, args.files / secs), flush=True)
+    finally:
+        server.terminate()
+        shutil.rmtree(tmp, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Per file latency of many small downloads when a few requests land on a
+server that's slow to answer. bench/server.py holds back every Nth response
+(--delay-every, --delay-ms), which without hedging sets the tail: the p99
+is the delay. With --hedge, requests still waiting once most have answered
+are sent again, and the copy that answers first is kept.
+
+Latencies are the total_us of each request from --stats-json, with -n so
+there's one request per file. Each setup is run a few times and the
+percentiles are taken over all files of all runs.
+
+    bench/hedge.py [--curler ./curler] [--files 1000] [--size 16384] [--transfers 16]
+                   [--delay-every 50] [--delay-ms 500] [--hedge 5] [--runs 3]
+"""
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from common import percentile, start_server
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def run(curler, extra, urls, tmp):
+    """Returns the latency of every request in ms, and the wall time in s."""
+    outdir = os.path.join(tmp, "out")
+    stats = os.path.join(tmp, "stats.json")
+    shutil.rmtree(outdir, ignore_errors=True)
+    os.makedirs(outdir)
+    start = time.monotonic()
+    subprocess.run([curler, "-n", "-p", outdir, "--stats-json", stats, "-f", urls] + extra,
+                   stdout=subprocess.DEVNULL, check=True)
+    wall = time.monotonic() - start
+    with open(stats) as f:
+        latencies = [json.loads(line)["total_us"] / 1000 for line in f]
+    return latencies, wall
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    parser.add_argument("--files", type=int, default=1000)
+    parser.add_argument("--size", type=int, default=16384)
+    parser.add_argument("--transfers", type=int, default=16)
+    parser.add_argument("--delay-every", type=int, default=50)
+    parser.add_argument("--delay-ms", type=int, default=500)
+    parser.add_argument("--hedge", type=float, default=5)
+    parser.add_argument("--runs", type=int, default=3)
+    args = parser.parse_args()
+
+    setups = [("no hedge", ["-e", str(args.transfers)]),
+              ("hedge %g%%" % args.hedge, ["-e", str(args.transfers), "--hedge", str(args.hedge)])]
+
+    server, port = start_server("--delay-every", args.delay_every, "--delay-ms", args.delay_ms)
+    tmp = tempfile.mkdtemp(prefix="curler-bench-")
+    try:
+        urls = os.path.join(tmp, "urls.txt")
+        with open(urls, "w") as f:
+            for i in range(args.files):
+                f.write("http://127.0.0.1:%d/%d/file%d.bin\n" % (port, args.size, i))
+
+        print("%-12s %10s %10s %10s %10s %10s" % ("setup", "p50 ms", "p90 ms", "p99 ms",
+                                                  "max ms", "wall s"))
+        for name, extra in setups:
+            latencies, walls = [], []
+            for _ in range(args.runs):
+                lat, wall = run(args.curler, extra, urls, tmp)
+                latencies += lat
+                walls.append(wall)
+            print("%-12s %10.1f %10.1f %10.1f %10.1f %10.2f" % (
+                name, percentile(latencies, 50), percentile(latencies, 90),
+                percentile(latencies, 99), max(latencies), sum(walls) / len(walls)), flush=True)
+    finally:
+        server.terminate()
+        shutil.rmtree(tmp, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+Compares HTTP/1.1 keep-alive with multiplexed HTTP/2 (--http2) for many
+small files from one origin. The files are served by nghttpd behind nghttpx,
+which takes both HTTP/1.1 and cleartext HTTP/2 on the same port, so both
+runs go through the same server and only the protocol curler speaks to it
+differs. Each mode is run with and without the header request (-n).
+
+Needs nghttpd and nghttpx (from nghttp2) in PATH, and curler running
+against libcurl 8 or later, which is needed for HTTP/2 without TLS.
+
+    bench/http2.py [--curler ./curler] [--files 2000] [--size 4096]
+                   [--transfers 64] [--streams 100]
+"""
+
+import argparse
+import os
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def free_port():
+    with socket.socket() as s:
+        s.bind(("127.0.0.1", 0))
+        return s.getsockname()[1]
+
+
+def wait_for(port):
+    deadline = time.monotonic() + 10
+    while time.monotonic() < deadline:
+        try:
+            socket.create_connection(("127.0.0.1", port), timeout=1).close()
+            return
+        except OSError:
+            time.sleep(0.05)
+    raise RuntimeError("nothing listening on port %d" % port)
+
+
+def start_servers(docroot):
+    """Starts nghttpd with nghttpx in front of it, returning (procs, port)."""
+    backend, frontend = free_port(), free_port()
+    procs = [subprocess.Popen(["nghttpd", "--no-tls", "-d", docroot, str(backend)],
+                              stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)]
+    wait_for(backend)
+    procs.append(subprocess.Popen(["nghttpx", "-f127.0.0.1,%d;no-tls" % frontend,
+                                   "-b127.0.0.1,%d;;proto=h2" % backend, "--workers=1",
+                                   "--accesslog-file=/dev/null", "--errorlog-file=/dev/null"],
+                                  stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL))
+    wait_for(frontend)
+    return procs, frontend
+
+
+def run(curler, flags, urlfile, outdir):
+    """Runs curler, returning (seconds, new connections, peak RSS in KiB, output)."""
+    shutil.rmtree(outdir, ignore_errors=True)
+    os.makedirs(outdir)
+    start = time.monotonic()
+    proc = subprocess.Popen([curler] + flags + ["-p", outdir, "-f", urlfile],
+                            stdout=subprocess.PIPE, text=True)
+    output = proc.stdout.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    secs = time.monotonic() - start
+    if os.waitstatus_to_exitcode(status) != 0:
+        raise RuntimeError("curler %s failed" % " ".join(flags))
+
+    # Connection pool: requests=<requests> reused=<reused> percent=<percent>
+    m = re.search(r"requests=(\d+) reused=(\d+)", output)
+    connections = int(m.group(1)) - int(m.group(2)) if m else None
+    return secs, connections, usage.ru_maxrss, output
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    parser.add_argument("--files", type=int, default=2000)
+    parser.add_argument("--size", type=int, default=4096)
+    parser.add_argument("--transfers", type=int, default=64, help="-e for both modes")
+    parser.add_argument("--streams", type=int, default=100, help="--http2 streams per connection")
+    args = parser.parse_args()
+
+    for tool in ("nghttpd", "nghttpx"):
+        if not shutil.which(tool):
+            print("%s not found, it comes with nghttp2" % tool, file=sys.stderr)
+            return 1
+
+    curler = os.path.abspath(args.curler)
+    tmp = tempfile.mkdtemp(prefix="curler-http2-")
+    docroot = os.path.join(tmp, "www")
+    outdir = os.path.join(tmp, "out")
+    urlfile = os.path.join(tmp, "urls.txt")
+    os.makedirs(docroot)
+    data = os.urandom(args.size)
+    for i in range(args.files):
+        with open(os.path.join(docroot, "%d.bin" % i), "wb") as f:
+            f.write(data)
+
+    procs, port = start_servers(docroot)
+    try:
+        with open(urlfile, "w") as f:
+            for i in range(args.files):
+                f.write("http://127.0.0.1:%d/%d.bin\n" % (port, i))
+
+        h2 = ["--http2", str(args.streams), "--http2-prior-knowledge"]
+        modes = [
+            ("http/1.1", []),
+            ("http/1.1 -n", ["-n"]),
+            ("http/2", h2),
+            ("http/2 -n", h2 + ["-n"]),
+        ]
+        print("%d files of %d bytes, -e %d\n" % (args.files, args.size, args.transfers))
+        print("%-12s %10s %10s %12s %10s" % ("mode", "seconds", "files/s", "connections", "RSS KiB"))
+        for name, flags in modes:
+            secs, connections, rss, output = run(curler, ["-e", str(args.transfers)] + flags,
+                                                 urlfile, outdir)
+            print("%-12s %10.2f %10.1f %12s %10d%s" %
+                  (name, secs, args.files / secs, connections, rss,
+                   "  (fell back to HTTP/1.1)" if "needs libcurl 8" in output else ""),
+                  flush=True)
+    finally:
+        for proc in reversed(procs):
+            proc.terminate()
+            proc.wait()
+        shutil.rmtree(tmp, ignore_errors=True)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,79 @@
+/*
+ * Messages per second the logger takes from many threads at once, against
+ * the mutex and std::endl per line it replaced, and what a message costs
+ * when its level is turned off (-q). Output goes to /dev/null, so this
+ * measures the logging and not the terminal. Times include writing out
+ * what's still on the ring at the end.
+ *
+ *     make bench/logger && bench/logger
+ */
+#include "../src/logger.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using bench_clock = std::chrono::steady_clock;
+
+static const int messages = 200000;  // Per thread
+static const std::string name = "/home/user/Downloads/some-file-name-1.2.3.tar.gz";
+
+static std::mutex old_mtx;
+
+/* The way log(msg, ext) used to write a line */
+static void old_log(const message &msg, const std::string &ext)
+{
+    std::lock_guard<std::mutex> lock(old_mtx);
+    std::cout << msg.text << " \"" << ext << "\"." << std::endl;
+}
+
+/* Runs fn(i) messages times on each of threads, and returns messages per second */
+template <typename F>
+static double run(int threads, F fn, bool async)
+{
+    std::vector<std::thread> workers;
+
+    if (async)
+	logger::init();
+    auto start = bench_clock::now();
+    for (int t = 0; t < threads; t++) {
+	workers.emplace_back([&fn] {
+	    for (int i = 0; i < messages; i++)
+		fn(i);
+	});
+    }
+    for (std::thread &w : workers)
+	w.join();
+    if (async)
+	logger::cleanup();
+
+    double secs = std::chrono::duration<double>(bench_clock::now() - start).count();
+    return threads * messages / secs;
+}
+
+int main()
+{
+    if (!freopen("/dev/null", "w", stdout)) {
+	perror("/dev/null");
+	return 1;
+    }
+
+    fprintf(stderr, "%-8s %18s %18s %18s\n", "threads", "mutex+endl (msg/s)",
+	    "ring (msg/s)", "quiet (msg/s)");
+    for (int threads : {1, 2, 4, 8, 16}) {
+	double old_rate = run(threads, [](int) { old_log(info[FILE_INFO_DOWNLOAD], name); }, false);
+	double ring_rate = run(threads, [](int) { log(info[FILE_INFO_DOWNLOAD], name); }, true);
+
+	logger::set_level(LOG_ERROR);
+	double quiet_rate = run(threads, [](int) { log(info[FILE_INFO_DOWNLOAD], name); }, true);
+	logger::set_level(LOG_INFO);
+
+	fprintf(stderr, "%-8d %18.0f %18.0f %18.0f\n", threads, old_rate, ring_rate, quiet_rate);
+    }
+
+    return 0;
+}
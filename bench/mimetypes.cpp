@@ -0,0 +1,106 @@
+/*
+ * Compares the perfect hash mimetype tables with the std::map they
+ * replaced: what the map costs to build at startup, and the cost of a
+ * lookup in either.
+ *
+ *     make bench/mimetypes && bench/mimetypes
+ */
+#include "../src/mimetypes.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+using MIMETYPES = std::map<const std::string, const std::string>;
+using bench_clock = std::chrono::steady_clock;
+
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    if (void *p = malloc(size))
+	return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/* Builds the map the way the old static initializer did */
+static MIMETYPES build_map()
+{
+    MIMETYPES map;
+    for (const mimetypes::entry &e : mimetypes::type_slots) {
+	if (!e.key.empty())
+	    map.emplace(std::string(e.key), std::string(e.value));
+    }
+    return map;
+}
+
+static double ns_since(bench_clock::time_point start, size_t n)
+{
+    return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count() / n;
+}
+
+int main()
+{
+    const int builds = 200;
+    const int rounds = 2000;
+    std::vector<std::string> keys;
+    size_t sink = 0;
+
+    for (const mimetypes::entry &e : mimetypes::type_slots) {
+	if (!e.key.empty())
+	    keys.emplace_back(e.key);
+    }
+    // Some misses too, like a real run sees
+    for (size_t i = 0; i < keys.size() / 4; i++)
+	keys.push_back(keys[i] + "; charset=iso-8859-1");
+
+    /* Startup */
+    allocations = 0;
+    auto start = bench_clock::now();
+    for (int i = 0; i < builds; i++) {
+	MIMETYPES map = build_map();
+	sink += map.size();
+    }
+    double build_ns = ns_since(start, builds);
+    size_t build_allocs = allocations / builds;
+
+    /* Lookups */
+    MIMETYPES map = build_map();
+    start = bench_clock::now();
+    for (int r = 0; r < rounds; r++) {
+	for (const std::string &key : keys) {
+	    auto it = map.find(key);
+	    if (it != map.end())
+		sink += it->second.length();
+	}
+    }
+    double map_ns = ns_since(start, rounds * keys.size());
+
+    start = bench_clock::now();
+    for (int r = 0; r < rounds; r++) {
+	for (const std::string &key : keys)
+	    sink += mimetypes::extension(key).length();
+    }
+    double hash_ns = ns_since(start, rounds * keys.size());
+
+    printf("%-14s %16s %14s %14s\n", "table", "startup (us)", "allocations", "lookup (ns)");
+    printf("%-14s %16.1f %14zu %14.1f\n", "std::map", build_ns / 1000, build_allocs, map_ns);
+    printf("%-14s %16.1f %14d %14.1f\n", "perfect hash", 0.0, 0, hash_ns);
+
+    return sink == 0;
+}
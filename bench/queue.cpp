@@ -0,0 +1,174 @@
+/*
+ * Entries per second through the download queue with many workers at once,
+ * against the per-worker work-stealing deques it replaced. One thread pushes
+ * like the feeder does and every worker pops and reports back right away,
+ * so this measures the queue alone, without any downloads to hide its cost.
+ * Each rate is the median of a few runs.
+ *
+ *     make bench/queue && bench/queue
+ */
+#include "../src/queue.h"
+#include "../src/options.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using bench_clock = std::chrono::steady_clock;
+
+static const int entries = 400000;
+static const int runs = 5;  // The median of these is reported
+
+/* The work-stealing queue the host grouped one replaced, as it was */
+class old_queue {
+public:
+    explicit old_queue(size_t workers)
+    {
+	for (size_t i = 0; i < workers; i++)
+	    lanes.push_back(std::make_unique<lane>());
+    }
+
+    void push(const urldata &data)
+    {
+	lane &l = *lanes[next_lane];
+	next_lane = (next_lane + 1) % lanes.size();
+	{
+	    std::lock_guard<std::mutex> lock(l.mtx);
+	    l.entries.push_back(data);
+	}
+
+	std::lock_guard<std::mutex> lock(wait_mtx);
+	pending++;
+	wait_cv.notify_one();
+    }
+
+    void close()
+    {
+	std::lock_guard<std::mutex> lock(wait_mtx);
+	closed = true;
+	wait_cv.notify_all();
+    }
+
+    bool pop(size_t worker, urldata &data)
+    {
+	for (;;) {
+	    if (try_pop(worker, data))
+		return true;
+
+	    std::unique_lock<std::mutex> lock(wait_mtx);
+	    wait_cv.wait(lock, [this] { return pending > 0 || closed; });
+	    if (closed && pending == 0)
+		return false;
+	}
+    }
+
+    void finished(size_t, const std::string &) {}
+
+private:
+    struct lane {
+	std::mutex mtx;
+	std::deque<urldata> entries;
+    };
+
+    bool try_pop(size_t worker, urldata &data)
+    {
+	size_t n = lanes.size();
+
+	for (size_t i = 0; i < n; i++) {
+	    lane &l = *lanes[(worker + i) % n];
+	    std::lock_guard<std::mutex> lock(l.mtx);
+
+	    if (l.entries.empty())
+		continue;
+	    if (i == 0) {
+		data = std::move(l.entries.front());
+		l.entries.pop_front();
+	    } else {
+		data = std::move(l.entries.back());
+		l.entries.pop_back();
+	    }
+	    pending--;
+	    return true;
+	}
+
+	return false;
+    }
+
+    std::vector<std::unique_ptr<lane>> lanes;
+    size_t next_lane = 0;
+    std::atomic<size_t> pending{0};
+    std::mutex wait_mtx;
+    std::condition_variable wait_cv;
+    bool closed = false;
+};
+
+/* Pushes urls from hosts in turn through q with workers threads, and returns entries per second */
+template <typename Q>
+static double run(Q &q, size_t workers, int hosts)
+{
+    auto path = std::make_shared<const std::string>(".");
+    std::vector<std::thread> threads;
+
+    auto start = bench_clock::now();
+    for (size_t w = 0; w < workers; w++) {
+	threads.emplace_back([&q, w] {
+	    urldata data;
+	    while (q.pop(w, data))
+		q.finished(w, data.url);
+	});
+    }
+    for (int i = 0; i < entries; i++) {
+	urldata data;
+	data.url = "https://host" + std::to_string(i % hosts) + ".example.com/files/" + std::to_string(i);
+	data.path = path;
+	q.push(std::move(data));
+    }
+    q.close();
+    for (std::thread &t : threads)
+	t.join();
+
+    double secs = std::chrono::duration<double>(bench_clock::now() - start).count();
+    return entries / secs;
+}
+
+/* Median of a few runs on a fresh queue each, made by make() */
+template <typename F>
+static double median_rate(F make, size_t workers, int hosts)
+{
+    std::vector<double> rates;
+
+    for (int i = 0; i < runs; i++) {
+	auto q = make();
+	rates.push_back(run(*q, workers, hosts));
+    }
+    std::sort(rates.begin(), rates.end());
+    return rates[runs / 2];
+}
+
+int main()
+{
+    printf("%-8s %-6s %16s %16s %16s\n", "workers", "hosts", "stealing (e/s)",
+	   "by host (e/s)", "limit 4 (e/s)");
+    for (int hosts : {1, 100}) {
+	for (size_t workers : {1, 4, 16, 64, 256}) {
+	    double old_rate = median_rate([workers] { return std::make_unique<old_queue>(workers); },
+					  workers, hosts);
+
+	    opts.host_connections = 0;
+	    double rate = median_rate([workers] { return std::make_unique<workqueue>(workers, 4096); },
+				      workers, hosts);
+
+	    opts.host_connections = 4;
+	    double limited_rate = median_rate(
+		[workers] { return std::make_unique<workqueue>(workers, 4096); }, workers, hosts);
+
+	    printf("%-8zu %-6d %16.0f %16.0f %16.0f\n", workers, hosts, old_rate, rate, limited_rate);
+	    fflush(stdout);
+	}
+    }
+
+    return 0;
+}
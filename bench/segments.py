@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+Times segmented downloads (-s) of one large file when some of the range
+requests land on a slow server node. bench/server.py sends every Nth range
+request at a crawl (--slow-every, --slow-rate), so with a fixed split the
+download takes as long as the slowest range, while segments that take over
+each other's work finish close to when the last byte could have come in.
+Each run is repeated and the median and worst wall times are reported, for
+curler and optionally for another build to compare against (--baseline).
+
+    bench/segments.py [--curler ./curler] [--baseline OTHER] [--size 268435456]
+                      [--segments 4] [--slow-every 4] [--slow-rate 1048576] [--runs 5]
+"""
+
+import argparse
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+from common import start_server
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def run(curler, segments, url, outdir):
+    shutil.rmtree(outdir, ignore_errors=True)
+    os.makedirs(outdir)
+    start = time.monotonic()
+    subprocess.run([curler, "-s", str(segments), "-p", outdir, "-u", url],
+                   stdout=subprocess.DEVNULL, check=True)
+    return time.monotonic() - start
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    parser.add_argument("--baseline")
+    parser.add_argument("--size", type=int, default=256 * 1024 * 1024)
+    parser.add_argument("--segments", type=int, default=4)
+    parser.add_argument("--slow-every", type=int, default=4)
+    parser.add_argument("--slow-rate", type=int, default=1024 * 1024)
+    parser.add_argument("--runs", type=int, default=5)
+    args = parser.parse_args()
+
+    builds = [("curler", args.curler)]
+    if args.baseline:
+        builds.append(("baseline", args.baseline))
+
+    server, port = start_server("--slow-every", args.slow_every, "--slow-rate", args.slow_rate)
+    tmp = tempfile.mkdtemp(prefix="curler-bench-")
+    try:
+        url = "http://127.0.0.1:%d/%d/file.bin" % (port, args.size)
+        outdir = os.path.join(tmp, "out")
+        print("%-10s %8s %12s %12s %10s" % ("build", "segments", "median s", "worst s", "MB/s"))
+        for name, curler in builds:
+            times = [run(curler, args.segments, url, outdir) for _ in range(args.runs)]
+            median = statistics.median(times)
+            print("%-10s %8d %12.2f %12.2f %10.1f" % (name, args.segments, median, max(times),
+                                                      args.size / median / 1e6), flush=True)
+    finally:
+        server.terminate()
+        shutil.rmtree(tmp, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
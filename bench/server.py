@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+Local HTTP stand-in server for benchmarking curler.
+
+Serves synthetic files without touching the disk. The path decides the
+size of the file: /<bytes>/<name> serves <bytes> bytes of a repeating
+pattern under the name <name>, so multi-GB files cost nothing to host.
+Supports HEAD, byte ranges, Last-Modified and ETag like a real server,
+including conditional requests.
+
+    bench/server.py [--port PORT] [--timings FILE] [--slow-every N --slow-rate BYTES]
+                    [--delay-every N --delay-ms MS]
+
+The chosen port is printed on the first line of stdout. With --timings
+every finished request is logged as "<start> <end> <path>", in seconds of
+the monotonic clock. With --slow-every, every Nth range request is sent at
+only --slow-rate bytes per second, like one landing on an overloaded node.
+With --delay-every, every Nth request waits --delay-ms before it's answered,
+like one stuck behind a garbage collection pause or a cold cache.
+"""
+
+import argparse
+import http.server
+import re
+import sys
+import threading
+import time
+
+BLOCK = bytes(range(256)) * 256  # 64 KiB pattern the files are made of
+LAST_MODIFIED = "Thu, 01 Jan 2026 00:00:00 GMT"
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True
+
+    def log_message(self, *args):
+        pass
+
+    def parse_request(self):
+        # Not in handle_one_request(), that includes the wait on a kept alive connection
+        self.start = time.monotonic()
+        return super().parse_request()
+
+    def log_timing(self):
+        timings = self.server.timings
+        if timings:
+            with self.server.timings_lock:
+                timings.write("%.6f %.6f %s\n" % (self.start, time.monotonic(), self.path))
+                timings.flush()
+
+    def send_headers(self):
+        """Sends the headers, returning the byte range to send or None."""
+        self.delay()
+        m = re.match(r"^/(\d+)/[^/]+$", self.path.split("?")[0])
+        if not m:
+            self.send_error(404)
+            return None
+
+        size = int(m.group(1))
+        etag = '"%x"' % size
+        if self.not_modified(etag):
+            self.send_response(304)
+            self.send_header("Last-Modified", LAST_MODIFIED)
+            self.send_header("ETag", etag)
+            self.end_headers()
+            return None
+
+        start, end = 0, size - 1
+        code = 200
+        rng = re.match(r"bytes=(\d*)-(\d*)$", self.headers.get("Range", ""))
+        if rng and (rng.group(1) or rng.group(2)):
+            if rng.group(1):
+                start = int(rng.group(1))
+                end = min(int(rng.group(2)), size - 1) if rng.group(2) else size - 1
+            else:
+                start = max(size - int(rng.group(2)), 0)
+            if start >= size:
+                self.send_response(416)
+                self.send_header("Content-Range", "bytes */%d" % size)
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                return None
+            code = 206
+
+        self.send_response(code)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(end - start + 1))
+        self.send_header("Accept-Ranges", "bytes")
+        self.send_header("Last-Modified", LAST_MODIFIED)
+        self.send_header("ETag", etag)
+        if code == 206:
+            self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, size))
+        self.end_headers()
+        return start, end
+
+    def not_modified(self, etag):
+        """Whether the request's conditions say the client has this version."""
+        match = self.headers.get("If-None-Match")
+        if match is not None:
+            return match.strip() == "*" or etag in [t.strip() for t in match.split(",")]
+        return self.headers.get("If-Modified-Since") == LAST_MODIFIED
+
+    def do_HEAD(self):
+        self.send_headers()
+        self.log_timing()
+
+    def do_GET(self):
+        rng = self.send_headers()
+        if rng is None:
+            self.log_timing()
+            return
+
+        pos, end = rng
+        rate = self.slow_rate() if "Range" in self.headers else 0
+        chunk = min(len(BLOCK), max(rate // 10, 1)) if rate else len(BLOCK)
+        view = memoryview(BLOCK)
+        try:
+            while pos <= end:
+                off = pos % len(BLOCK)
+                n = min(len(BLOCK) - off, end - pos + 1, chunk)
+                self.wfile.write(view[off:off + n])
+                pos += n
+                if rate:
+                    time.sleep(n / rate)
+        except (BrokenPipeError, ConnectionResetError):
+            self.close_connection = True  # The client had what it wanted
+        self.log_timing()
+
+    def delay(self):
+        """Holds back every --delay-every'th response."""
+        server = self.server
+        if not server.delay_every:
+            return
+        with server.slow_lock:
+            server.requests += 1
+            late = server.requests % server.delay_every == 0
+        if late:
+            time.sleep(server.delay_ms / 1000)
+
+    def slow_rate(self):
+        """The rate to send this range at, or 0 for as fast as possible."""
+        server = self.server
+        if not server.slow_every:
+            return 0
+        with server.slow_lock:
+            server.ranges += 1
+            return server.slow_rate if server.ranges % server.slow_every == 0 else 0
+
+
+class Server(http.server.ThreadingHTTPServer):
+    daemon_threads = True
+    request_queue_size = 4096
+    timings = None
+    timings_lock = threading.Lock()
+    slow_every = 0
+    slow_rate = 0
+    slow_lock = threading.Lock()
+    ranges = 0
+    delay_every = 0
+    delay_ms = 0
+    requests = 0
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--port", type=int, default=0)
+    parser.add_argument("--timings")
+    parser.add_argument("--slow-every", type=int, default=0)
+    parser.add_argument("--slow-rate", type=int, default=1024 * 1024)
+    parser.add_argument("--delay-every", type=int, default=0)
+    parser.add_argument("--delay-ms", type=int, default=1000)
+    args = parser.parse_args()
+
+    server = Server(("127.0.0.1", args.port), Handler)
+    if args.timings:
+        server.timings = open(args.timings, "w")
+    server.slow_every = args.slow_every
+    server.slow_rate = args.slow_rate
+    server.delay_every = args.delay_every
+    server.delay_ms = args.delay_ms
+    print(server.server_address[1], flush=True)
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
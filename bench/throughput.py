@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+End-to-end throughput benchmark. Runs the curler binary over generated -f
+lists against bench/server.py, for a mix of workloads: many tiny files,
+some medium ones, and a few multi-GB ones (synthesized by the server, so
+they cost nothing to host, but they are written to disk). The sync
+workload downloads a list of tiny files with --sync, then times a second
+run over it, when nothing has changed.
+
+For every workload it reports files/s, MB/s, the p50 and p99 per-file
+latency (first request for a file to the last byte of it, as seen by the
+server) and curler's peak RSS. The results are written as JSON, one object
+per workload with sorted keys, so two runs can be diffed.
+
+    bench/throughput.py [--curler ./curler] [--out bench/results.json] [--quick]
+"""
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from common import percentile, start_server
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+KIB = 1024
+MIB = 1024 * KIB
+GIB = 1024 * MIB
+
+# name, number of files, size of each, curler flags, whether to time a --sync rerun
+WORKLOADS = [
+    ("tiny", 2000, 4 * KIB, ["-e", "64"], False),
+    ("medium", 40, 16 * MIB, ["-j", "8"], False),
+    ("large", 2, 2 * GIB, ["-s", "4"], False),
+    ("sync", 2000, 4 * KIB, ["-e", "64"], True),
+]
+
+QUICK_WORKLOADS = [
+    ("tiny", 500, 4 * KIB, ["-e", "64"], False),
+    ("medium", 10, 4 * MIB, ["-j", "4"], False),
+    ("large", 1, 256 * MIB, ["-s", "4"], False),
+    ("sync", 500, 4 * KIB, ["-e", "64"], True),
+]
+
+
+def run_curler(cmd):
+    """Runs cmd, returning (exit status, seconds, peak RSS in KiB)."""
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    _, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    return proc.returncode, time.monotonic() - start, usage.ru_maxrss
+
+
+def file_latencies(timings, since):
+    """Seconds from the first request for each file to the end of the last one."""
+    spans = {}
+    with open(timings) as f:
+        for line in f:
+            start, end, path = line.split(" ", 2)
+            if float(start) < since:
+                continue
+            first, last = spans.get(path, (float(start), float(end)))
+            spans[path] = (min(first, float(start)), max(last, float(end)))
+    return sorted(last - first for first, last in spans.values())
+
+
+def run_workload(curler, name, files, size, flags, sync, tmp):
+    timings = os.path.join(tmp, name + ".timings")
+    urlfile = os.path.join(tmp, name + ".txt")
+    outdir = os.path.join(tmp, "out")
+    shutil.rmtree(outdir, ignore_errors=True)
+    os.makedirs(outdir)
+
+    server, port = start_server("--timings", timings)
+    try:
+        with open(urlfile, "w") as f:
+            for i in range(files):
+                f.write("http://127.0.0.1:%d/%d/%s%d.bin\n" % (port, size, name, i))
+
+        cmd = [curler] + flags + ["-p", outdir, "-f", urlfile]
+        if sync:
+            cmd += ["--sync", os.path.join(tmp, name + ".sync")]
+            status, _, _ = run_curler(cmd)
+            if status != 0:
+                raise RuntimeError("%s: first run failed with exit %d" % (name, status))
+        # Same clock as the server's
+        since = time.monotonic()
+        status, secs, rss = run_curler(cmd)
+    finally:
+        server.terminate()
+        server.wait()
+        shutil.rmtree(outdir, ignore_errors=True)
+
+    latencies = file_latencies(timings, since)
+    p50, p99 = percentile(latencies, 50), percentile(latencies, 99)
+    return {
+        "workload": name,
+        "files": files,
+        "file_size": size,
+        "flags": " ".join(flags + (["--sync"] if sync else [])),
+        "exit_status": status,
+        "seconds": round(secs, 3),
+        "files_per_sec": round(files / secs, 1),
+        "mb_per_sec": round(files * size / secs / 1e6, 1),
+        "latency_p50_ms": round(p50 * 1000, 2) if p50 is not None else None,
+        "latency_p99_ms": round(p99 * 1000, 2) if p99 is not None else None,
+        "peak_rss_kib": rss,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    parser.add_argument("--out", default=os.path.join(HERE, "results.json"))
+    parser.add_argument("--quick", action="store_true", help="smaller workloads, for a fast check")
+    args = parser.parse_args()
+
+    curler = os.path.abspath(args.curler)
+    workloads = QUICK_WORKLOADS if args.quick else WORKLOADS
+    tmp = tempfile.mkdtemp(prefix="curler-bench-")
+    results = []
+    try:
+        print("%-8s %8s %10s %10s %10s %10s %10s" %
+              ("workload", "files", "files/s", "MB/s", "p50 ms", "p99 ms", "RSS KiB"))
+        for name, files, size, flags, sync in workloads:
+            r = run_workload(curler, name, files, size, flags, sync, tmp)
+            results.append(r)
+            print("%-8s %8d %10.1f %10.1f %10s %10s %10d%s" %
+                  (name, files, r["files_per_sec"], r["mb_per_sec"],
+                   r["latency_p50_ms"], r["latency_p99_ms"], r["peak_rss_kib"],
+                   "" if r["exit_status"] == 0 else "  (exit %d)" % r["exit_status"]),
+                  flush=True)
+    finally:
+        shutil.rmtree(tmp, ignore_errors=True)
+
+    with open(args.out, "w") as f:
+        json.dump({
+            "curler": curler,
+            "machine": platform.machine(),
+            "kernel": platform.release(),
+            "cpus": os.cpu_count(),
+            "quick": args.quick,
+            "results": results,
+        }, f, indent=2, sort_keys=True)
+        f.write("\n")
+    print("Results written to %s" % args.out)
+
+    return 0 if all(r["exit_status"] == 0 for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,27 +10,28 @@ extern "C" {
 /*
  * Struct to hold headers that doesn't have curler functions that
  * automatically extract them for us. For use in header_callback(),
- * passed in with CURLOPT_HEADERDATA.
+ * passed in with CURLOPT_HEADERDATA. Filled in by parse_header_line().
  */
 typedef struct txt_headers {
-    char content_disposition[512] = "None";
+    char content_disposition[512] = "None";  // Decoded filename from content-disposition
     char location[1024] = "None";
+    char etag[256] = "None";
+    char last_modified[64] = "None";
+    char content_encoding[64] = "None";
+    bool accept_ranges = false;
+    bool filename_ext = false;      // Filename came from filename*, which beats filename
+    long long range_start = -1;     // From content-range, -1 if not given
+    long long range_end = -1;
+    long long range_length = -1;    // Full length of the file, -1 if not given
 } txt_headers;
 
-/* custom callback function for CURLOPT_WRITEFUNCTION. */
-size_t write_callback(void *ptr, size_t size, size_t nmemb, FILE *stream);
-
 /*
- * Custom callback function for CURLOPT_HEADERFUNCTION to extract header data.
- * Currently only used to get the filename and location if available.
+ * Custom callback function for CURLOPT_HEADERFUNCTION to extract header data
+ * into a txt_headers struct.
  */
 size_t header_callback(char *buffer, size_t size, size_t nitems,
 		       void *userdata);
 
-/* custom callback function for CURLOPT_PROGRESSFUNCTION to create a progress bar. */
-int progress_callback(void *ptr, double total_to_download, double now_downloaded,
-		      double total_to_upload, double now_uploaded);
-
 #ifdef __cplusplus
 }
 #endif
@@ -1,99 +1,899 @@
 #include "curler.h"
 #include "callbacks.h"
 #include "fileops.h"
+#include "handlepool.h"
 #include "logger.h"
 #include "mimetypes.h"
+#include "options.h"
+#include "stats.h"
+#include "validators.h"
 
 #include <curl/curl.h>
+#include <algorithm>
+#include <condition_variable>
+#include <fcntl.h>
+#include <limits>
+#include <mutex>
+#include <random>
 #include <string.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
-
-struct headers {
-    long long content_length = 0;
-    char content_type[16] = "";
-    char content_disposition[512] = "None";
-    char location[1024] = "None";
-    time_t filetime = 0;
-};
+// Don't split files into segments smaller than this
+#define MIN_SEGMENT_SIZE (1024 * 1024)
+// Don't take over from a segment that would be done within this many milliseconds anyway
+#define STEAL_MIN_MS 1000
+// A segment that got nothing for this long counts as stalled, and is taken over whole
+#define SEGMENT_STALL_MS 2000
+// How often a segment with nothing to do looks for one to take over again
+#define STEAL_RETRY_MS 250
+// Appended to the name of a file that failed its digest check twice
+#define DIGEST_BAD_SUFFIX ".corrupt"
+// Files at least this large get a resume journal from the start, smaller ones only if they fail
+#define JOURNAL_MIN_SIZE (1024 * 1024)
+// Wait before the first retry. Every one after that waits twice as long as the last
+#define RETRY_DELAY_MS 1000
+// Longest wait between retries
+#define RETRY_MAX_DELAY_MS (60 * 1000)
+// Longest wait we take from a server's Retry-After
+#define RETRY_AFTER_MAX_MS (5 * 60 * 1000)
 
 
 /* Function prototypes */
 bool download(const std::string &url, const std::string &path,
-	      const std::string &filename);
+	      const std::string &filename, const std::string &checksum);
+bool download(CURL *curl, const std::string &url, const std::string &path,
+	      const std::string &filename, const std::string &checksum);
 static std::string find_filename(const std::string &url,
-				 const std::string &path, const headers &hdrs,
-				 CURL *curl);
+				 const std::string &path, const headers &hdrs);
 static std::string get_fullpath(const std::string &path,
 				const std::string &filename,
 				const headers &hdrs);
-static headers get_headers(const std::string &url, CURL *curl);
+static void request_headers(const std::string &url, CURL *curl,
+			    txt_headers *thdrs);
+static headers get_headers(const std::string &url, CURL *curl,
+			   const txt_headers &thdrs);
+static const char *url_extension(const std::string &url);
 static curl_off_t get_resume_point(const std::string &fullpath,
 				   const headers &hdrs);
+static unsigned int count_segments(const headers &hdrs);
+static bool download_segmented(const std::string &url, const std::string &path,
+			       const std::string &fullpath,
+			       const headers &hdrs, unsigned int segments,
+			       progress::slot *bar, journal *jrnl);
+struct splitter;
+static bool download_range(CURL *curl, const std::string &url, const std::string &path,
+			   const std::string &fullpath, int fd, long long start, long long end,
+			   progress::slot *bar, journal *jrnl, splitter *sp, double *rate);
+static bool steal(splitter *sp, const std::string &fullpath, double rate,
+		  long long *start, long long *end);
+static bool remote_changed(const journal &jrnl, const headers &hdrs);
+static bool retryable(CURLcode res, long status);
+static long jitter(long max);
+static size_t segment_callback(char *ptr, size_t size, size_t nmemb, void *userdata);
+static int segment_progress(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+			    curl_off_t ultotal, curl_off_t ulnow);
+
+using segment_clock = std::chrono::steady_clock;
 
+/*
+ * One range of a segmented download, for segment_callback(). While the
+ * request runs, steal() can hand the end of the range to another segment by
+ * lowering end, and the data past it is then dropped.
+ */
+struct segment {
+    segment(sink *out, CURL *curl, journal *jrnl, long long start, long long end)
+	: out(out), curl(curl), jrnl(jrnl), start(start), asked(end), began(segment_clock::now()),
+	  end(end), pos(start), last_data(began) {}
 
-bool download(const std::string &url, const std::string &path, const std::string &filename)
+    sink *out;
+    CURL *curl;
+    journal *jrnl;
+    long long start;
+    long long asked;  // Last byte of the range asked for
+    segment_clock::time_point began;
+    progress::meter meter;
+    bool checked = false;  // Response code checked
+
+    std::mutex mtx;        // Guards the rest
+    long long end;         // Last byte still left to this segment
+    long long pos;         // Next byte to come in
+    segment_clock::time_point last_data;
+    bool cut = false;      // Stopped at end, since the rest went to another segment
+};
+
+/*
+ * The segments of a download that have a request running, for the ones
+ * that are done with theirs to take work over from
+ */
+struct splitter {
+    std::mutex mtx;
+    std::condition_variable cv;  // Signalled whenever a request finishes
+    std::vector<segment *> running;
+    bool failed = false;         // A range couldn't be downloaded, so stop taking on more
+};
+
+
+bool download(const std::string &url, const std::string &path, const std::string &filename,
+	      const std::string &checksum)
 {
-    CURL *curl = curl_easy_init();
+    CURL *curl = handlepool::acquire();
 
     if (curl) {
-	curl_off_t *resume_point = new curl_off_t;
-	CURLcode res;
-	FILE *fp;
-	headers hdrs = get_headers(url, curl);
-	std::string fname = filename;
-	std::string fullpath;
-
-
-	if (fname.empty())
-	    fname = find_filename(url, path, hdrs, curl);
-	fname = fileops::clean_filename(fname);
-	fullpath = get_fullpath(path, fname, hdrs);
-	*resume_point = get_resume_point(fullpath, hdrs);
-
-	/* Check that we have write permissions */
-	if (!fileops::is_writeable(path)) {
-	    log(err[FILE_ERR_PERMS]);
-	    curl_easy_cleanup(curl);
-	    delete resume_point;
+	bool res = download(curl, url, path, filename, checksum);
+	handlepool::release(curl);
+	return res;
+    } else
+	return false;
+}
+
+
+bool download(CURL *curl, const std::string &url, const std::string &path,
+	      const std::string &filename, const std::string &checksum)
+{
+    if (curl) {
+	transfer t(curl, url, path, filename, checksum);
+
+	while (t.next()) {
+	    std::this_thread::sleep_for(std::chrono::milliseconds(t.delay()));
+	    t.done(curl_easy_perform(curl));
+	}
+
+	return t.result();
+    } else
+	return false;
+}
+
+
+transfer::transfer(CURL *curl, const std::string &url, const std::string &path,
+		   const std::string &filename, const std::string &checksum)
+    : curl(curl), url(url), path(path), filename(filename),
+      check(checksum.empty() ? nullptr : std::make_unique<digest::hasher>(checksum))
+{
+}
+
+
+transfer::~transfer()
+{
+    close_file();
+    progress::remove(bar);
+    curl_slist_free_all(extra_headers);
+}
+
+
+/*
+ * Sets up the curl handle for the next request of the download.
+ * Returns false when the download is finished.
+ */
+bool transfer::next()
+{
+    switch (st) {
+    case state::START:
+	// Only what changed since the last sync, if we know what we got then
+	if (!opts.sync_file.empty() && start_conditional()) {
+	    st = state::BODY;
+	    return true;
+	}
+	if (opts.no_head) {
+	    if (start_direct(true)) {
+		st = state::BODY;
+		return true;
+	    }
+	    st = state::FINISHED;
 	    return false;
 	}
+	request_headers(url, curl, &thdrs);
+	st = state::HEADERS;
+	return true;
+
+    case state::HEADERS:
+	/*
+	 * Servers that don't do HEAD answer with something like a 405, and
+	 * the body request may still work. Any other failure is retried.
+	 */
+	if (res != CURLE_OK && (res != CURLE_HTTP_RETURNED_ERROR || retryable(res, status)
+				|| status == 404 || status == 410)) {
+	    handlepool::reset(curl);
+	    if (retry()) {
+		thdrs = txt_headers();
+		request_headers(url, curl, &thdrs);
+		return true;
+	    }
+	    st = state::FINISHED;
+	    return false;
+	}
+	hdrs = get_headers(url, curl, thdrs);
+	handlepool::reset(curl);
+	// A segmented download is done within start_body(), and may need another go
+	if (start_body() || (restart && refetch())) {
+	    st = state::BODY;
+	    return true;
+	}
+	st = state::FINISHED;
+	return false;
 
-	// Already downloaded, skipping
-	if (*resume_point == -1) {
-	    curl_easy_cleanup(curl);
-	    delete resume_point;
+    case state::BODY:
+	finish_body();
+	handlepool::reset(curl);
+	if (restart && refetch())
 	    return true;
+	// Only failed requests, not a file that couldn't be written
+	if (!ok && res != CURLE_OK) {
+	    if (retry())
+		return resume();
+	    // Nothing of it ever made it to disk, so don't leave an empty file behind
+	    fileinfo left = fileops::lookup(fullpath);
+	    if (resume_point == 0 && left.exists && left.size == 0) {
+		unlink(fullpath.c_str());
+		fileops::removed(fullpath);
+		jrnl.remove();
+	    }
 	}
+	st = state::FINISHED;
+	return false;
 
-	if (*resume_point != 0)
-	    fp = std::fopen(fullpath.c_str(), "a+b");
-	else
-	    fp = std::fopen(fullpath.c_str(), "wb");
-	curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-	curl_easy_setopt(curl, CURLOPT_RESUME_FROM_LARGE, *resume_point);
-	curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
-	curl_easy_setopt(curl, CURLOPT_PROGRESSFUNCTION, progress_callback);
-	curl_easy_setopt(curl, CURLOPT_PROGRESSDATA, resume_point);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
-
-	log(info[FILE_INFO_DOWNLOAD], fullpath);
-	res = curl_easy_perform(curl);
-	std::fclose(fp);
-
-	// Try to set file modification time to remote file time
-	if ((CURLE_OK == res) && (hdrs.filetime >= 0)) {
-	    if (!fileops::set_filetime(fullpath, hdrs.filetime))
-		log(err[FILE_ERR_FILETIME]);
+    default:
+	return false;
+    }
+}
+
+
+/* Called with the result of the request set up by next() */
+void transfer::done(CURLcode res)
+{
+    curl_off_t after = 0;
+
+    this->res = res;
+    stats::record(curl, res, {st == state::HEADERS ? "head" : "body", url, fullpath,
+			      st == state::HEADERS ? 0 : resume_point, attempts});
+    if (res == CURLE_OK)
+	attempts = 0;
+    status = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+    curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &after);
+    retry_after = after;
+    handlepool::record(curl);
+
+    if (logger::enabled(LOG_DEBUG)) {
+	curl_off_t bytes = 0, total = 0;
+	curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &bytes);
+	curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &total);
+	log(info[DEBUG_INFO_REQUEST], url, {{"request", st == state::HEADERS ? "head" : "body"},
+					    {"status", status}, {"result", res},
+					    {"bytes", bytes}, {"ms", total / 1000}});
+    }
+}
+
+
+/*
+ * Milliseconds to wait before performing the request set up by next(),
+ * when it's a retry that's backing off
+ */
+long transfer::delay() const
+{
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+	not_before - std::chrono::steady_clock::now());
+
+    return left.count() > 0 ? static_cast<long>(left.count()) : 0;
+}
+
+
+/*
+ * Works out where the file goes and whether to resume it, and sets up the
+ * body request. Returns false if there's nothing to download, either because
+ * it failed or the file is already complete.
+ */
+bool transfer::start_body()
+{
+    std::string fname = filename;
+
+    if (fname.empty())
+	fname = find_filename(url, path, hdrs);
+    fname = fileops::clean_filename(fname);
+    fullpath = get_fullpath(path, fname, hdrs);
+    resume_point = find_resume_point();
+
+    /* Check that we have write permissions */
+    if (!fileops::is_writeable(path)) {
+	log(err[FILE_ERR_PERMS]);
+	ok = false;
+	return false;
+    }
+
+    // Already downloaded, skipping
+    if (resume_point == -1) {
+	validators::record(url, filename, fullpath, hdrs.etag, hdrs.last_modified);
+	ok = true;
+	return false;
+    }
+
+    log(info[FILE_INFO_DOWNLOAD], fullpath);
+    if (bar)
+	progress::reset(bar, fullpath.substr(fullpath.rfind('/') + 1),
+			hdrs.content_length > 0 ? hdrs.content_length : -1, resume_point);
+    else
+	bar = progress::add(fullpath.substr(fullpath.rfind('/') + 1),
+			    hdrs.content_length > 0 ? hdrs.content_length : -1, resume_point);
+
+    // Split large files over several connections if the server allows it
+    unsigned int segments = resume_point == 0 ? count_segments(hdrs) : 1;
+    if (segments > 1) {
+	log(info[FILE_INFO_SEGMENTED], segments);
+	if (download_segmented(url, path, fullpath, hdrs, segments, bar, &jrnl)) {
+	    res = CURLE_OK;
+	    finish_body();
+	    return false;
+	}
+	log(warn[FILE_WARN_SEGMENTED]);
+	// Carry on from the first gap the segments left
+	resume_point = jrnl.contiguous();
+	progress::reset(bar, fullpath.substr(fullpath.rfind('/') + 1), hdrs.content_length,
+			resume_point);
+    }
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    // An error page isn't the file, see retry()
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    progress::attach(curl, bar, &meter);
+
+    if (resume_point > 0) {
+	// The response tells whether to continue or start over, see open_output()
+	request_rest();
+	thdrs = txt_headers();
+	curl_easy_setopt(curl, CURLOPT_FILETIME, 1L);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &thdrs);
+	ratelimit::attach(curl, &gate, url, path, body_callback, this);
+    } else {
+	if (!open_file(false)) {
+	    ok = false;
+	    return false;
+	}
+	ratelimit::attach(curl, &gate, url, path, sink::write_callback, out);
+    }
+    if (opts.buffer_size > 0)
+	curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, opts.buffer_size);
+
+    return true;
+}
+
+
+/*
+ * Sets up the body request straight away, without a header request first
+ * (-n). The name is worked out from what we were given and the url, and if
+ * resume is set and that file exists we ask for the rest of it with a range
+ * request. The response then decides what happens, see open_output() and
+ * finish_body().
+ */
+bool transfer::start_direct(bool resume)
+{
+    headers guess;  // The url is all we have to go on
+    std::string fname = filename;
+
+    /* Check that we have write permissions */
+    if (!fileops::is_writeable(path)) {
+	log(err[FILE_ERR_PERMS]);
+	ok = false;
+	return false;
+    }
+
+    if (const char *extension = url_extension(url))
+	snprintf(guess.content_type, sizeof(guess.content_type), "%s", extension);
+    if (fname.empty())
+	fname = find_filename(url, path, guess);
+    fullpath = get_fullpath(path, fileops::clean_filename(fname), guess);
+
+    // A journal says how much of the file is really there, and which version it is
+    if (resume) {
+	fileinfo local = fileops::lookup(fullpath);
+	if (local.exists && jrnl.load(fullpath) && jrnl.url == url)
+	    resume_point = jrnl.contiguous();
+	else if (local.exists)
+	    resume_point = local.size;
+    }
+
+    // Renamed in open_output() if the response says otherwise
+    if (bar)
+	progress::reset(bar, fullpath.substr(fullpath.rfind('/') + 1), -1, resume_point);
+    else
+	bar = progress::add(fullpath.substr(fullpath.rfind('/') + 1), -1, resume_point);
+
+    if (resume_point > 0)
+	request_rest();
+    request_body();
+
+    return true;
+}
+
+
+/*
+ * Sets up a conditional GET for a url the last sync recorded (--sync), as
+ * long as the file it went into hasn't been touched since. The server then
+ * answers with 304 if its version hasn't changed either, and otherwise with
+ * the new one, which replaces the file. Returns false if there's nothing to
+ * go on, and the download should go the usual way.
+ */
+bool transfer::start_conditional()
+{
+    validators::entry e;
+    std::string dir = path.back() != '/' ? path + '/' : path;
+
+    if (!validators::lookup(url, &e) || !validators::unchanged(e))
+	return false;
+    // Asked for under another name, or downloaded into another path last time
+    if (e.filename != filename
+	|| e.fullpath.compare(0, dir.length(), dir) != 0
+	|| e.fullpath.find('/', dir.length()) != std::string::npos)
+	return false;
+
+    fullpath = e.fullpath;
+    conditional = true;
+
+    curl_slist_free_all(extra_headers);
+    extra_headers = nullptr;
+    if (!e.etag.empty())
+	extra_headers = curl_slist_append(extra_headers, ("If-None-Match: " + e.etag).c_str());
+    if (!e.last_modified.empty())
+	extra_headers = curl_slist_append(extra_headers,
+					  ("If-Modified-Since: " + e.last_modified).c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, extra_headers);
+
+    bar = progress::add(fullpath.substr(fullpath.rfind('/') + 1), -1, 0);
+    request_body();
+
+    return true;
+}
+
+
+/*
+ * Sets up the rest of a body request whose response decides what to do
+ * with the file, see open_output().
+ */
+void transfer::request_body()
+{
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    curl_easy_setopt(curl, CURLOPT_FILETIME, 1L);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &thdrs);
+    progress::attach(curl, bar, &meter);
+    ratelimit::attach(curl, &gate, url, path, body_callback, this);
+    if (opts.buffer_size > 0)
+	curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, opts.buffer_size);
+}
+
+
+/*
+ * Sets up the download again from scratch, once finish_body() has asked for
+ * it with restart. Returns false if there's nothing to download after all.
+ */
+bool transfer::refetch()
+{
+    thdrs = txt_headers();
+    resume_point = 0;
+    restart = false;
+    conditional = false;
+
+    return opts.no_head ? start_direct(false) : start_body();
+}
+
+
+/*
+ * Decides whether the request that just failed gets another go, and sets
+ * when. Failures that trying again can't fix, like a 404 or a full disk,
+ * don't, and neither does one that failed opts.retries times in a row
+ * without getting any more of the file onto disk. Each retry waits twice
+ * as long as the last, give or take some jitter, so downloads that failed
+ * together don't all come back at once, and at least as long as the server
+ * asked for with Retry-After.
+ */
+bool transfer::retry()
+{
+    std::string reason = res == CURLE_HTTP_RETURNED_ERROR ? "HTTP " + std::to_string(status)
+	: curl_easy_strerror(res);
+    std::string name = fullpath.empty() ? url : fullpath.substr(fullpath.rfind('/') + 1);
+
+    // Got further than last time, so it's not the same failure again
+    long long have = jrnl.active() ? jrnl.contiguous() : 0;
+    if (have > progress_at) {
+	attempts = 0;
+	progress_at = have;
+    }
+
+    if (!retryable(res, status) || attempts >= opts.retries) {
+	log(err[FILE_ERR_REQUEST], name, {{"reason", reason}});
+	return false;
+    }
+
+    long wait = std::min<long>(static_cast<long>(RETRY_DELAY_MS) << std::min(attempts, 16u),
+			       RETRY_MAX_DELAY_MS);
+    wait = wait / 2 + jitter(wait / 2);
+    if (retry_after > 0)
+	wait = std::max<long>(wait, std::min<long long>(retry_after * 1000, RETRY_AFTER_MAX_MS));
+    not_before = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait);
+    attempts++;
+
+    char when[32];
+    snprintf(when, sizeof(when), "%.1f", wait / 1000.0);
+    log(warn[FILE_WARN_RETRY], name, {{"reason", reason},
+				      {"retry", std::to_string(attempts) + '/' + std::to_string(opts.retries)},
+				      {"wait", std::string(when) + 's'}});
+
+    return true;
+}
+
+
+/*
+ * Sets up the body request again once retry() has said so, from the end of
+ * what's on disk, which the journal knows to the byte. Without a journal
+ * nothing was written, and the download starts over.
+ */
+bool transfer::resume()
+{
+    bool journaled = !fullpath.empty() && fileops::file_exists(fullpath)
+	&& jrnl.load(fullpath) && jrnl.url == url;
+
+    thdrs = txt_headers();
+    resume_point = journaled ? jrnl.contiguous() : 0;
+    progress::reset(bar, fullpath.substr(fullpath.rfind('/') + 1),
+		    hdrs.content_length > 0 ? hdrs.content_length : -1, resume_point);
+
+    if (resume_point > 0)
+	request_rest();
+    else if (conditional && !journaled)
+	// The file is still the one from the last sync, which may be current
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, extra_headers);
+    request_body();
+
+    return true;
+}
+
+
+/*
+ * Called at the first byte of the body of a request from start_direct(), or
+ * of a resume from start_body(), once all the response headers are in.
+ * Appends to the file if the server honoured our range request, and
+ * otherwise opens it from scratch. Without a header request first (-n) the
+ * name then comes from the response.
+ * Returns false if the file couldn't be opened.
+ */
+bool transfer::open_output()
+{
+    long response_code = 0;
+
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    headers response = get_headers(url, curl, thdrs);
+
+    if (response_code == 206 && resume_point > 0) {
+	// Anywhere but where we asked for, and the data would land in the wrong place
+	if (thdrs.range_start >= 0 && thdrs.range_start != resume_point)
+	    return false;
+
+	// The header request already told us all about the file
+	if (opts.no_head) {
+	    // content_length only covers the part we asked for
+	    response.content_length = thdrs.range_length >= 0 ? thdrs.range_length
+		: response.content_length + resume_point;
+	    hdrs = response;
+	    log(info[FILE_INFO_EXISTS], fullpath);
+	    log(info[FILE_INFO_RESUME], resume_point);
+	}
+	return open_file(true);
+    } else {
+	// If-Range failed, or the server doesn't do ranges
+	if (resume_point > 0 && jrnl.active() && remote_changed(jrnl, response))
+	    log(warn[FILE_WARN_CHANGED], fullpath);
+	resume_point = 0;
+
+	if (conditional)
+	    log(info[FILE_INFO_DOWNLOAD], fullpath);
+	else if (opts.no_head) {
+	    std::string fname = filename;
+	    if (fname.empty())
+		fname = find_filename(url, path, response);
+	    fullpath = get_fullpath(path, fileops::clean_filename(fname), response);
+	    log(info[FILE_INFO_DOWNLOAD], fullpath);
 	} else
-	    log(warn[FILE_WARN_FILETIME]);
+	    strcpy(response.content_type, hdrs.content_type);
+	hdrs = response;
+	progress::reset(bar, fullpath.substr(fullpath.rfind('/') + 1),
+			hdrs.content_length > 0 ? hdrs.content_length : -1, 0);
+	return open_file(false);
+    }
+}
 
-	curl_easy_cleanup(curl);
-	delete resume_point;
-	return true;
-    } else
+
+/*
+ * Opens the file for the body, and a sink writing to it. With append the
+ * data goes after the resume point, otherwise the file is truncated first.
+ * If the size is known, the disk space for it is checked and preallocated
+ * (-a) before anything is written.
+ * Returns false if the file couldn't be opened or doesn't fit.
+ */
+bool transfer::open_file(bool append)
+{
+    long long offset = append ? resume_point : 0;
+    long long length = hdrs.content_length > offset ? hdrs.content_length - offset : -1;
+
+    if (length > 0) {
+	long long space = fileops::get_free_space(path);
+	if (space >= 0 && space < length) {
+	    log(err[FILE_ERR_SPACE], fullpath);
+	    return false;
+	}
+    }
+
+    fd = open(fullpath.c_str(), O_WRONLY | O_CREAT | (append ? 0 : O_TRUNC), 0644);
+    if (fd < 0) {
+	log(err[FILE_ERR_OPEN], fullpath);
 	return false;
+    }
+    fileops::created(fullpath);
+
+    if (length > 0 && opts.prealloc != prealloc_mode::NONE) {
+	preallocated = fileops::preallocate(fd, offset, length,
+					    opts.prealloc == prealloc_mode::KEEP);
+	if (!preallocated)
+	    log(warn[FILE_WARN_PREALLOC], fullpath);
+    }
+
+    out = new sink(fd, offset, length);
+    if (opts.transfers > 0)
+	out->set_pause(curl);
+
+    /*
+     * Small files only get a journal if they fail, see finish_body(), so
+     * they don't pay for writing one each.
+     */
+    jrnl.start(fullpath, url, hdrs.etag, hdrs.last_modified,
+	       hdrs.content_length > 0 ? hdrs.content_length : -1, offset);
+    if (hdrs.content_length <= 0 || hdrs.content_length >= JOURNAL_MIN_SIZE) {
+	jrnl.save();
+	out->set_journal(&jrnl);
+    }
+
+    // What's already there is hashed once here, the rest as it's written
+    if (check) {
+	check->reset();
+	if (!append || check->update_from_file(fullpath, offset))
+	    out->set_hasher(check.get());
+    }
+
+    return true;
+}
+
+
+/* Waits for the sink and closes the file. Returns false if a write failed */
+bool transfer::close_file()
+{
+    bool written = true;
+
+    if (out) {
+	written = out->flush();
+	if (written)
+	    jrnl.add_range(out->get_start(), out->get_offset());
+	/*
+	 * Cut a preallocated file back to what was actually written, so a
+	 * short transfer leaves a file that can be resumed by its size.
+	 */
+	if (preallocated && ftruncate(fd, out->get_offset()) < 0)
+	    written = false;
+	delete out;
+	out = nullptr;
+	preallocated = false;
+    }
+    if (fd >= 0) {
+	close(fd);
+	fd = -1;
+    }
+
+    return written;
+}
+
+
+/*
+ * Custom callback function for CURLOPT_WRITEFUNCTION for requests from
+ * start_direct(). Opens the file at the first byte of the body, and throws
+ * away the body of a 416 response.
+ */
+size_t transfer::body_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    transfer *t = static_cast<transfer *>(userdata);
+
+    if (!t->out) {
+	long response_code = 0;
+	curl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &response_code);
+	if (response_code == 416)
+	    return size * nmemb;
+	if (!t->open_output())
+	    return 0;
+    }
+
+    return sink::write_callback(ptr, size, nmemb, t->out);
+}
+
+
+/*
+ * Races the request set up by next() against the same request on rival.
+ * curl looks its callbacks up as it calls them, and nothing has come in on
+ * handle() yet, so both handles can be put behind the race callbacks here.
+ */
+void transfer::hedge(CURL *rival)
+{
+    this->rival = rival;
+    decided = false;
+    lanes[0] = {this, curl};
+    lanes[1] = {this, rival};
+
+    for (lane &l : lanes) {
+	curl_easy_setopt(l.curl, CURLOPT_HEADERFUNCTION, race_header_callback);
+	curl_easy_setopt(l.curl, CURLOPT_HEADERDATA, &l);
+	// The header request has no body
+	if (st == state::BODY) {
+	    curl_easy_setopt(l.curl, CURLOPT_WRITEFUNCTION, race_write_callback);
+	    curl_easy_setopt(l.curl, CURLOPT_WRITEDATA, &l);
+	}
+    }
+}
+
+
+/* Stops the race, with the rival carrying on if loser is handle() */
+void transfer::end_race(CURL *loser)
+{
+    if (loser == curl && rival)
+	take_over(rival);
+    rival = nullptr;
+}
+
+
+/*
+ * Whether data that came in on from goes through, deciding the race if
+ * it's the first to get any
+ */
+bool transfer::claim(CURL *from)
+{
+    if (rival && !decided) {
+	decided = true;
+	if (from == rival) {
+	    rival = curl;
+	    take_over(from);
+	}
+    }
+
+    return from == curl;
+}
+
+
+/* Makes from the handle of this transfer, in place of the one that lost */
+void transfer::take_over(CURL *from)
+{
+    curl = from;
+    gate.curl = from;
+    if (out && opts.transfers > 0)
+	out->set_pause(from);
+}
+
+
+/*
+ * Custom callback function for CURLOPT_HEADERFUNCTION for both handles of
+ * a race, see hedge(). The first header line decides it.
+ */
+size_t transfer::race_header_callback(char *buffer, size_t size, size_t nitems, void *userdata)
+{
+    lane *l = static_cast<lane *>(userdata);
+
+    // Anything but the full size fails the loser's request
+    if (!l->t->claim(l->curl))
+	return 0;
+
+    return header_callback(buffer, size, nitems, &l->t->thdrs);
+}
+
+
+/* Custom callback function for CURLOPT_WRITEFUNCTION for both handles of a race */
+size_t transfer::race_write_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    lane *l = static_cast<lane *>(userdata);
+
+    if (!l->t->claim(l->curl))
+	return 0;
+
+    return ratelimit::deliver(ptr, size, nmemb, &l->t->gate);
+}
+
+
+/* Closes the file and sets its modification time once the body is in */
+void transfer::finish_body()
+{
+    // curl fails a request on an error status, but a 416 tells us something, see below
+    if (res == CURLE_HTTP_RETURNED_ERROR && status == 416)
+	res = CURLE_OK;
+
+    if ((opts.no_head || conditional || resume_point > 0) && !out && res == CURLE_OK) {
+	long response_code = 0;
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+
+	// Same version as last time, and the file hasn't been touched since
+	if (conditional && response_code == 304) {
+	    log(info[FILE_INFO_UPTODATE], fullpath.substr(fullpath.rfind('/') + 1));
+	    ok = true;
+	    return;
+	}
+
+	/*
+	 * 416 means we asked for a range starting past the end of the file.
+	 * Either the file is complete, or it's larger than the remote one
+	 * and has to be downloaded again. That's left to the next run when
+	 * the name came from a header request.
+	 */
+	if (response_code == 416) {
+	    if (thdrs.range_length == resume_point) {
+		log(info[FILE_INFO_SKIP], fullpath.substr(fullpath.rfind('/') + 1));
+		jrnl.remove();
+		ok = true;
+	    } else {
+		log(warn[FILE_WARN_LARGER], fullpath);
+		restart = opts.no_head;
+		ok = opts.no_head;
+	    }
+	    return;
+	}
+
+	// Empty body, but the file should still be there
+	if (!open_output()) {
+	    ok = false;
+	    return;
+	}
+    }
+
+    if (!close_file()) {
+	log(err[FILE_ERR_WRITE], fullpath);
+	ok = false;
+	return;
+    }
+
+    // Before anything takes the file for complete
+    if (res == CURLE_OK && check && !check->verify(fullpath)) {
+	jrnl.remove();
+	ok = false;
+	if (!refetched) {
+	    log(warn[FILE_WARN_DIGEST], fullpath);
+	    unlink(fullpath.c_str());
+	    fileops::removed(fullpath);
+	    restart = refetched = true;
+	} else {
+	    // Kept for a look, under a name no later run mistakes for the file
+	    log(err[FILE_ERR_DIGEST], fullpath);
+	    if (rename(fullpath.c_str(), (fullpath + DIGEST_BAD_SUFFIX).c_str()) == 0) {
+		fileops::removed(fullpath);
+		fileops::created(fullpath + DIGEST_BAD_SUFFIX);
+	    }
+	}
+	return;
+    }
+
+    // Keep track of what made it to disk, so a retry or the next run can resume it
+    if (res != CURLE_OK) {
+	jrnl.save();
+	ok = false;
+	return;
+    }
+    jrnl.remove();
+
+    // Try to set file modification time to remote file time
+    if (hdrs.filetime >= 0) {
+	if (!fileops::set_filetime(fullpath, hdrs.filetime))
+	    log(err[FILE_ERR_FILETIME]);
+    } else
+	log(warn[FILE_WARN_FILETIME]);
+
+    // After the modification time is set, since that's part of what's recorded
+    validators::record(url, filename, fullpath, hdrs.etag, hdrs.last_modified);
+
+    ok = true;
 }
 
 
@@ -102,20 +902,13 @@ bool download(const std::string &url, const std::string &path, const std::string
  * falling back on a generic name "file" if it can't be determined otherwise.
  */
 static std::string find_filename(const std::string &url, const std::string &path,
-				 const headers &hdrs, CURL *curl)
+				 const headers &hdrs)
 {
     std::string filename;
 
+    // Already unquoted and decoded by parse_header_line()
     if (strcmp(hdrs.content_disposition, "None") != 0) {
-	// Make sure we have a nice decoded filename if we found one
-	int outlength;
-	char *fname = curl_easy_unescape(curl, hdrs.content_disposition,
-					 strlen(hdrs.content_disposition), &outlength);
-	filename = fname;
-	curl_free(fname);
-
-	// Temp workaround for removing the trailing "
-	filename.pop_back();
+	filename = hdrs.content_disposition;
     }
     // Filename not found in content-disposition. Try the url, or use the location if found.
     else {
@@ -152,7 +945,7 @@ static std::string find_filename(const std::string &url, const std::string &path
 	    do {
 		filename = name + std::to_string(number);
 		number++;
-	    } while (fileops::file_exists(path.back() != '/' ? path + '/' : path
+	    } while (fileops::file_exists((path.back() != '/' ? path + '/' : path)
 					  + filename + hdrs.content_type));
 	}
     }
@@ -195,34 +988,46 @@ static std::string get_fullpath(const std::string &path, const std::string &file
 }
 
 /*
- * Uses curl to fetch headers to get the content-type, content-disposition,
- * content-length, file modification time, and file location if applicable.
- * Will reset the curl options back to the default when finished, but will
- * keep the connection alive.
+ * Sets up curl to fetch the headers of url, which get_headers() reads once
+ * the request has been performed. Header lines we parse ourselves end up in
+ * thdrs.
  */
-static headers get_headers(const std::string &url, CURL *curl)
+static void request_headers(const std::string &url, CURL *curl, txt_headers *thdrs)
 {
-    headers hdrs;
-    txt_headers thdrs;
-    char *content_type = nullptr;
-    double content_length = 0.0;
-    time_t filetime = 0;
-
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
     curl_easy_setopt(curl, CURLOPT_FILETIME, 1L);
     curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &thdrs);
-    curl_easy_perform(curl);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, thdrs);
+}
+
+
+/*
+ * Gets the content-type, content-disposition, content-length, file
+ * modification time, and file location if applicable from the header
+ * request set up by request_headers(), or from the headers of a body request.
+ */
+static headers get_headers(const std::string &url, CURL *curl, const txt_headers &thdrs)
+{
+    headers hdrs;
+    char *content_type = nullptr;
+    curl_off_t content_length = 0;
+    time_t filetime = 0;
 
-    curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &content_length);
+    curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
     curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &content_type);
     curl_easy_getinfo(curl, CURLINFO_FILETIME, &filetime);
 
     strcpy(hdrs.content_disposition, thdrs.content_disposition);
     strcpy(hdrs.location, thdrs.location);
-    hdrs.content_length = static_cast<long long>(content_length);
+    if (strcmp(thdrs.etag, "None") != 0)
+	snprintf(hdrs.etag, sizeof(hdrs.etag), "%s", thdrs.etag);
+    if (strcmp(thdrs.last_modified, "None") != 0)
+	snprintf(hdrs.last_modified, sizeof(hdrs.last_modified), "%s", thdrs.last_modified);
+    hdrs.accept_ranges = thdrs.accept_ranges;
+    hdrs.content_length = content_length;
     hdrs.filetime = filetime;
 
     if (content_type) {
@@ -231,22 +1036,107 @@ static headers get_headers(const std::string &url, CURL *curl)
 	    *it = std::tolower(static_cast<unsigned char>(*it));
     }
 
-    if (content_type && mimetypes.find(content_type) != mimetypes.end())
-	strcpy(hdrs.content_type, mimetypes.at(content_type).c_str());
-    else if (url.substr( url.rfind('/') ).rfind('.') != std::string::npos)  // Try to get extension from the url.
-	strcpy(hdrs.content_type, url.substr(url.rfind('.')).c_str());
+    std::string_view extension = content_type ? mimetypes::extension(content_type) : "";
+    if (!extension.empty())
+	snprintf(hdrs.content_type, sizeof(hdrs.content_type), "%.*s",
+		 static_cast<int>(extension.length()), extension.data());
+    else if (const char *url_ext = url_extension(url))  // Try to get extension from the url.
+	snprintf(hdrs.content_type, sizeof(hdrs.content_type), "%s", url_ext);
     else {
 	// Can't determine file type. Set to .bin
 	log(warn[FILE_WARN_FILETYPE]);
 	strcpy(hdrs.content_type, ".bin");
     }
 
-    curl_easy_reset(curl);
-
     return hdrs;
 }
 
 
+/*
+ * The extension of the last path component of url, dot included, or
+ * nullptr if it has none. Callers cut it to fit headers::content_type.
+ */
+static const char *url_extension(const std::string &url)
+{
+    size_t dot = url.rfind('.');
+    size_t slash = url.rfind('/');
+
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+	return nullptr;
+
+    return url.c_str() + dot;
+}
+
+
+/*
+ * Works out where to resume the file at fullpath from. A journal left by an
+ * earlier run says exactly how much of it is on disk and which version of
+ * the remote file that was. Files without one are left to get_resume_point().
+ * Returns the byte we should resume at, 0 to download it all, or -1 if it's
+ * already complete.
+ */
+curl_off_t transfer::find_resume_point()
+{
+    if (!fileops::file_exists(fullpath) || !jrnl.load(fullpath))
+	return get_resume_point(fullpath, hdrs);
+
+    if (jrnl.url != url || remote_changed(jrnl, hdrs)) {
+	log(warn[FILE_WARN_CHANGED], fullpath);
+	return 0;
+    }
+
+    long long done = jrnl.contiguous();
+    if (hdrs.content_length > 0 && done >= hdrs.content_length) {
+	// Killed after the last write, but before the journal was removed
+	log(info[FILE_INFO_SKIP], fullpath.substr(fullpath.rfind('/') + 1));
+	jrnl.remove();
+	return -1;
+    }
+    if (done > 0) {
+	log(info[FILE_INFO_EXISTS], fullpath);
+	log(info[FILE_INFO_RESUME], done);
+    }
+
+    return done;
+}
+
+
+/*
+ * Asks for the file from resume_point on. If there's a journal, the request
+ * is made with If-Range, so a server whose file has changed since answers
+ * with all of it instead.
+ */
+void transfer::request_rest()
+{
+    /*
+     * Not CURLOPT_RESUME_FROM_LARGE, since curl fails the transfer if the
+     * server answers with the whole file, and we'd rather just take it.
+     */
+    std::string range = std::to_string(resume_point) + '-';
+    curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+
+    std::string validator = jrnl.active() ? jrnl.validator() : "";
+    if (!validator.empty()) {
+	curl_slist_free_all(extra_headers);
+	extra_headers = curl_slist_append(nullptr, ("If-Range: " + validator).c_str());
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, extra_headers);
+    }
+}
+
+
+/* Whether hdrs describe another version of the file than the one in jrnl */
+static bool remote_changed(const journal &jrnl, const headers &hdrs)
+{
+    if (!jrnl.etag.empty() && hdrs.etag[0] != '\0' && jrnl.etag != hdrs.etag)
+	return true;
+    if (!jrnl.last_modified.empty() && hdrs.last_modified[0] != '\0'
+	&& jrnl.last_modified != hdrs.last_modified)
+	return true;
+
+    return jrnl.length > 0 && hdrs.content_length > 0 && jrnl.length != hdrs.content_length;
+}
+
+
 /*
  * Checks if a file has already been downloaded, and if so checks if it should
  * be skipped or if we should resume the download.
@@ -257,9 +1147,10 @@ static curl_off_t get_resume_point(const std::string &fullpath, const headers &h
 {
     std::string filename = fullpath.substr(fullpath.rfind('/') + 1, fullpath.length());
 
-    if (fileops::file_exists(fullpath)) {
-	time_t local_filetime = fileops::get_filetime(fullpath);
-	long long local_filesize = fileops::get_filesize(fullpath);
+    fileinfo local = fileops::lookup(fullpath);
+    if (local.exists) {
+	time_t local_filetime = local.mtime;
+	long long local_filesize = local.size;
 
 	// Check if both filetime and filesize match
 	if (hdrs.filetime > 0 && hdrs.filetime == local_filetime) {
@@ -286,3 +1177,337 @@ static curl_off_t get_resume_point(const std::string &fullpath, const headers &h
 	return 0;
     }
 }
+
+
+/*
+ * Returns how many segments a fresh download should be split into. That's
+ * the number asked for with -s, as long as the server accepts range requests
+ * and every segment gets at least MIN_SEGMENT_SIZE bytes. Otherwise 1.
+ */
+static unsigned int count_segments(const headers &hdrs)
+{
+    // The event engine can't block on the segment connections
+    if (opts.transfers > 0)
+	return 1;
+
+    if (opts.segments <= 1 || !hdrs.accept_ranges || hdrs.content_length <= 0)
+	return 1;
+
+    long long max_segments = hdrs.content_length / MIN_SEGMENT_SIZE;
+    if (max_segments < opts.segments)
+	return max_segments > 1 ? static_cast<unsigned int>(max_segments) : 1;
+
+    return opts.segments;
+}
+
+
+/*
+ * Downloads the file in segments byte ranges over as many connections at
+ * the same time, writing every range at its offset in the file. The file is
+ * split evenly to begin with, but a segment that's done with its range takes
+ * over the end of the one that would finish last, see steal(), so a slow or
+ * stalled connection doesn't hold up the whole download.
+ * Returns false if any of the ranges failed or the server didn't honour the
+ * range request, in which case the file has to be downloaded again.
+ */
+static bool download_segmented(const std::string &url, const std::string &path,
+			       const std::string &fullpath, const headers &hdrs,
+			       unsigned int segments, progress::slot *bar, journal *jrnl)
+{
+    long long space = fileops::get_free_space(fullpath.substr(0, fullpath.rfind('/') + 1));
+    if (space >= 0 && space < hdrs.content_length) {
+	log(err[FILE_ERR_SPACE], fullpath);
+	return false;
+    }
+
+    int fd = open(fullpath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+	return false;
+    fileops::created(fullpath);
+
+    // Size the file up front so every segment can write at its offset
+    if (opts.prealloc != prealloc_mode::NONE)
+	fileops::preallocate(fd, 0, hdrs.content_length, false);
+    if (ftruncate(fd, hdrs.content_length) < 0) {
+	close(fd);
+	return false;
+    }
+
+    // The file is full size from here on, so only the journal tells what's in it
+    jrnl->start(fullpath, url, hdrs.etag, hdrs.last_modified, hdrs.content_length);
+    jrnl->save();
+
+    splitter sp;
+    std::vector<std::thread> threads;
+    long long seg_size = hdrs.content_length / segments;
+
+    // Every segment starts on an equal share, then helps out the slower ones
+    auto work = [&url, &path, &fullpath, &sp, fd, bar, jrnl](long long start, long long end) {
+	CURL *curl = handlepool::acquire();
+	double rate = 0;
+	bool ok = curl && download_range(curl, url, path, fullpath, fd, start, end,
+					 bar, jrnl, &sp, &rate);
+
+	while (ok) {
+	    handlepool::reset(curl);
+	    if (!steal(&sp, fullpath, rate, &start, &end))
+		break;
+	    ok = download_range(curl, url, path, fullpath, fd, start, end, bar, jrnl, &sp, &rate);
+	}
+
+	if (curl)
+	    handlepool::release(curl);
+	if (!ok) {
+	    std::lock_guard<std::mutex> lock(sp.mtx);
+	    sp.failed = true;
+	}
+	sp.cv.notify_all();
+    };
+
+    for (unsigned int i = 0; i < segments; i++) {
+	long long start = i * seg_size;
+	// The last segment also takes the remainder
+	long long end = (i == segments - 1) ? hdrs.content_length - 1 : (i + 1) * seg_size - 1;
+	threads.emplace_back(work, start, end);
+    }
+
+    for (std::thread &t : threads)
+	t.join();
+    close(fd);
+    jrnl->save();
+
+    return !sp.failed;
+}
+
+
+/*
+ * Downloads bytes start to end of the file into fd over curl, as one of the
+ * segments of download_segmented(), while letting others take over the end
+ * of the range. Sets rate to the bytes per second it got.
+ * Returns false if what was left to it didn't all make it to disk, or the
+ * server didn't honour the range request.
+ */
+static bool download_range(CURL *curl, const std::string &url, const std::string &path,
+			   const std::string &fullpath, int fd, long long start, long long end,
+			   progress::slot *bar, journal *jrnl, splitter *sp, double *rate)
+{
+    // Fails the transfer if the server sends more than the range
+    sink out(fd, start, end - start + 1, true);
+    std::string range = std::to_string(start) + '-' + std::to_string(end);
+    long response_code = 0;
+    ratelimit::gate gate;
+    segment seg(&out, curl, jrnl, start, end);
+
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+    ratelimit::attach(curl, &gate, url, path, segment_callback, &seg);
+    progress::attach(curl, bar, &seg.meter);
+    // Also without a dashboard, to let go of a stalled range that was taken over
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, segment_progress);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &seg);
+    if (opts.buffer_size > 0)
+	curl_easy_setopt(curl, CURLOPT_BUFFERSIZE, opts.buffer_size);
+
+    {
+	std::lock_guard<std::mutex> lock(sp->mtx);
+	sp->running.push_back(&seg);
+    }
+    CURLcode res = curl_easy_perform(curl);
+    {
+	std::lock_guard<std::mutex> lock(sp->mtx);
+	sp->running.erase(std::find(sp->running.begin(), sp->running.end(), &seg));
+    }
+    sp->cv.notify_all();
+
+    // Cut short on purpose isn't a failed request
+    stats::record(curl, seg.cut ? CURLE_OK : res, {"segment", url, fullpath, start, 0});
+    handlepool::record(curl);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    // Anything but 206 means the server ignored the range
+    bool written = out.flush();
+    if (written && response_code == 206)
+	jrnl->add_range(start, out.get_offset());
+
+    double secs = std::chrono::duration<double>(segment_clock::now() - seg.began).count();
+    *rate = secs > 0 ? (out.get_offset() - start) / secs : 0;
+
+    // A range cut short ends with an error, but all of what's left to it is there
+    return written && ((res == CURLE_OK && response_code == 206) || seg.cut)
+	&& out.get_offset() == seg.end + 1;
+}
+
+
+/*
+ * Finds the running segment that would finish last, and takes over the end
+ * of its range, split so both would finish at the same time when this one
+ * goes on at rate. A segment that has stalled is taken over whole. While the
+ * others are all too close to done to be worth it, waits for that to change.
+ * Sets start and end to the range taken over. Returns false once every
+ * range is done, or one has failed.
+ */
+static bool steal(splitter *sp, const std::string &fullpath, double rate,
+		  long long *start, long long *end)
+{
+    std::unique_lock<std::mutex> lock(sp->mtx);
+
+    // Nothing came in on the last range, so this connection is no help
+    if (rate <= 0)
+	return false;
+
+    while (!sp->failed && !sp->running.empty()) {
+	auto now = segment_clock::now();
+	segment *victim = nullptr;
+	long long victim_take = 0;
+	double latest = 0;
+
+	for (segment *seg : sp->running) {
+	    std::lock_guard<std::mutex> seg_lock(seg->mtx);
+	    long long left = seg->end + 1 - seg->pos;
+	    if (left <= 0)
+		continue;
+
+	    double secs = std::chrono::duration<double>(now - seg->began).count();
+	    double seg_rate;
+	    if (now - seg->last_data >= std::chrono::milliseconds(SEGMENT_STALL_MS))
+		seg_rate = 0;
+	    else if (seg->pos == seg->start)
+		seg_rate = rate;  // Too early to tell, so assume it's as fast as we are
+	    else
+		seg_rate = (seg->pos - seg->start) / secs;
+
+	    // Seconds it would still take on its own
+	    double finish = seg_rate > 0 ? left / seg_rate : std::numeric_limits<double>::infinity();
+	    if (finish * 1000 < STEAL_MIN_MS)
+		continue;
+	    long long take = left - static_cast<long long>(left * (seg_rate / (seg_rate + rate)));
+	    if (take <= 0)
+		continue;
+
+	    if (!victim || finish > latest) {
+		victim = seg;
+		victim_take = take;
+		latest = finish;
+	    }
+	}
+
+	if (victim) {
+	    std::lock_guard<std::mutex> seg_lock(victim->mtx);
+	    // It has gone on since
+	    long long take = std::min(victim_take, victim->end + 1 - victim->pos);
+	    if (take > 0) {
+		*end = victim->end;
+		*start = victim->end + 1 - take;
+		victim->end = *start - 1;
+		lock.unlock();
+		log(info[DEBUG_INFO_STEAL], fullpath, {{"from", *start}, {"to", *end}});
+		return true;
+	    }
+	}
+
+	sp->cv.wait_for(lock, std::chrono::milliseconds(STEAL_RETRY_MS));
+    }
+
+    return false;
+}
+
+
+/*
+ * Whether a request that ended with res, and the HTTP status, is worth
+ * another try: the connection failed, dropped or stalled (--speed-time),
+ * or the server was overloaded or briefly unavailable.
+ */
+static bool retryable(CURLcode res, long status)
+{
+    switch (res) {
+    case CURLE_COULDNT_CONNECT:
+    case CURLE_OPERATION_TIMEDOUT:
+    case CURLE_SEND_ERROR:
+    case CURLE_RECV_ERROR:
+    case CURLE_GOT_NOTHING:
+    case CURLE_PARTIAL_FILE:
+    case CURLE_SSL_CONNECT_ERROR:
+    case CURLE_HTTP2:
+    case CURLE_HTTP2_STREAM:
+	return true;
+    case CURLE_HTTP_RETURNED_ERROR:
+	return status == 408 || status == 425 || status == 429 || status == 500
+	    || status == 502 || status == 503 || status == 504;
+    default:
+	return false;
+    }
+}
+
+
+/* Random number of milliseconds from 0 to max */
+static long jitter(long max)
+{
+    static thread_local std::mt19937 rng(std::random_device{}());
+
+    return std::uniform_int_distribution<long>(0, max)(rng);
+}
+
+
+/*
+ * Custom callback function for CURLOPT_WRITEFUNCTION for the segments of
+ * download_segmented(). Fails the segment at once if the server ignored the
+ * range, and only then lets the sink record its data in the journal.
+ */
+static size_t segment_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    segment *seg = static_cast<segment *>(userdata);
+    size_t len = size * nmemb;
+    size_t keep = len;
+
+    if (!seg->checked) {
+	long response_code = 0;
+	curl_easy_getinfo(seg->curl, CURLINFO_RESPONSE_CODE, &response_code);
+	if (response_code != 206)
+	    return 0;
+	seg->out->set_journal(seg->jrnl);
+	seg->checked = true;
+    }
+
+    {
+	std::lock_guard<std::mutex> lock(seg->mtx);
+	long long left = seg->end + 1 - seg->pos;
+	// Past an end that was lowered, the data is another segment's to get
+	if (seg->end < seg->asked && left < static_cast<long long>(len)) {
+	    keep = left > 0 ? left : 0;
+	    seg->cut = true;
+	}
+	seg->pos += keep;
+	seg->last_data = segment_clock::now();
+    }
+
+    if (keep > 0 && sink::write_callback(ptr, 1, keep, seg->out) != keep)
+	return 0;
+
+    // Stops the request
+    return seg->cut ? 0 : len;
+}
+
+
+/*
+ * Custom callback function for CURLOPT_XFERINFOFUNCTION for the segments of
+ * download_segmented(). Passes the progress on to the dashboard, and stops
+ * the request once another segment has taken over all that was left of it,
+ * which for a stalled one may be before any data comes.
+ */
+static int segment_progress(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+			    curl_off_t ultotal, curl_off_t ulnow)
+{
+    segment *seg = static_cast<segment *>(clientp);
+
+    if (seg->meter.bar)
+	progress::xferinfo_callback(&seg->meter, dltotal, dlnow, ultotal, ulnow);
+
+    std::lock_guard<std::mutex> lock(seg->mtx);
+    if (seg->end < seg->asked && seg->pos > seg->end) {
+	seg->cut = true;
+	return 1;
+    }
+
+    return 0;
+}
@@ -1,9 +1,153 @@
 #ifndef CURLER_H
 #define CURLER_H
 
+#include "callbacks.h"
+#include "digest.h"
+#include "journal.h"
+#include "progress.h"
+#include "ratelimit.h"
+#include "writer.h"
+
+#include <chrono>
+#include <curl/curl.h>
+#include <memory>
 #include <string>
 
+struct headers {
+    long long content_length = 0;
+    char content_type[16] = "";
+    char content_disposition[512] = "None";
+    char location[1024] = "None";
+    char etag[256] = "";           // Empty if the server didn't send one
+    char last_modified[64] = "";
+    time_t filetime = 0;
+    bool accept_ranges = false;
+};
+
+/*
+ * A single download, split into the requests it needs (the header request
+ * and the body) so it can be driven either by blocking curl_easy_perform()
+ * calls or by the event engine. The caller repeatedly calls next() to get
+ * the curl handle set up for the next request, performs it, and hands the
+ * result back with done(), until next() returns false. A request that's
+ * retried after a failure may have to wait a while first, see delay().
+ */
+class transfer {
+public:
+    transfer(CURL *curl, const std::string &url, const std::string &path,
+	     const std::string &filename, const std::string &checksum);
+    ~transfer();
+
+    /*
+     * Sets up the curl handle for the next request of the download.
+     * Returns false when the download is finished.
+     */
+    bool next();
+    /* Called with the result of the request set up by next() */
+    void done(CURLcode res);
+    /*
+     * Milliseconds to wait before performing the request set up by next(),
+     * when it's a retry that's backing off
+     */
+    long delay() const;
+    /* Whether the download succeeded (or was skipped). Valid once finished */
+    bool result() const { return ok; }
+
+    CURL *handle() const { return curl; }
+    const std::string &get_url() const { return url; }
+    const std::string &get_filename() const { return filename; }
+
+    /*
+     * Races the request set up by next() against the same request on rival,
+     * a copy of handle() (--hedge). Must be called before any response came
+     * in on handle(). The first of the two to get one becomes handle(), and
+     * the other one is refused any data from then on.
+     */
+    void hedge(CURL *rival);
+    /* The handle racing handle(), until end_race() */
+    CURL *get_rival() const { return rival; }
+    /* Whether one of the two got a response first, so the rival has lost */
+    bool race_decided() const { return decided; }
+    /*
+     * Stops the race once loser is off the loop. If that's handle(), failing
+     * before either got a response, the rival carries on in its place.
+     */
+    void end_race(CURL *loser);
+
+private:
+    enum class state { START, HEADERS, BODY, FINISHED };
+
+    bool start_body();
+    bool start_direct(bool resume);
+    bool start_conditional();
+    bool refetch();
+    bool retry();
+    bool resume();
+    void request_body();
+    curl_off_t find_resume_point();
+    void request_rest();
+    bool open_output();
+    bool open_file(bool append);
+    bool close_file();
+    void finish_body();
+
+    /* One of the two handles of a race, for the callbacks standing in front of it */
+    struct lane {
+	transfer *t;
+	CURL *curl;
+    };
+
+    bool claim(CURL *from);
+    void take_over(CURL *from);
+
+    static size_t body_callback(char *ptr, size_t size, size_t nmemb,
+				void *userdata);
+    static size_t race_header_callback(char *buffer, size_t size, size_t nitems,
+				       void *userdata);
+    static size_t race_write_callback(char *ptr, size_t size, size_t nmemb,
+				      void *userdata);
+
+    CURL *curl;
+    std::string url;
+    std::string path;
+    std::string filename;
+    state st = state::START;
+    CURLcode res = CURLE_OK;
+    long status = 0;  // HTTP status of the last request
+    long long retry_after = 0;  // Seconds the server asked us to wait, from Retry-After
+    bool ok = false;
+
+    txt_headers thdrs;
+    headers hdrs;
+    std::string fullpath;
+    curl_off_t resume_point = 0;
+    int fd = -1;
+    sink *out = nullptr;
+    bool preallocated = false;
+    bool restart = false;  // Range request failed, download from scratch
+    bool conditional = false;  // Asked with the validators of the last sync
+    std::unique_ptr<digest::hasher> check;  // For the expected digest, if there's one
+    bool refetched = false;  // Downloaded again after a digest mismatch
+    unsigned int attempts = 0;  // Retries in a row that didn't get any further
+    long long progress_at = 0;  // Bytes on disk at the last failure
+    std::chrono::steady_clock::time_point not_before;  // Earliest start of the next request
+    journal jrnl;
+    curl_slist *extra_headers = nullptr;  // If-Range, or conditions for a sync
+    progress::slot *bar = nullptr;
+    progress::meter meter;
+    ratelimit::gate gate;
+    CURL *rival = nullptr;  // Racing curl for the same request, see hedge()
+    bool decided = false;   // One of them got a response first
+    lane lanes[2];
+};
+
 bool download(const std::string &url, const std::string &path,
-	      const std::string &filename);
+	      const std::string &filename, const std::string &checksum);
+/*
+ * Same as above, but uses the caller's curl handle so it can be kept for
+ * several downloads. The handle is reset to its defaults when done.
+ */
+bool download(CURL *curl, const std::string &url, const std::string &path,
+	      const std::string &filename, const std::string &checksum);
 
 #endif
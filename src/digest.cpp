@@ -0,0 +1,135 @@
+#include "digest.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fcntl.h>
+#include <openssl/evp.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Chunk size for reading back files
+#define READ_SIZE (1024 * 1024)
+
+using digest::hasher;
+
+static const EVP_MD *find_algorithm(const std::string &spec, std::string *hex);
+
+
+bool digest::valid(const std::string &spec)
+{
+    std::string hex;
+    const EVP_MD *md = find_algorithm(spec, &hex);
+
+    return md && hex.length() == 2 * static_cast<size_t>(EVP_MD_get_size(md));
+}
+
+
+bool digest::looks_like(std::string_view word)
+{
+    size_t colon = word.find(':');
+
+    if (colon == 0 || colon == std::string_view::npos || word.length() - colon - 1 < 8
+	|| word.find('/') != std::string_view::npos)
+	return false;
+
+    if (!std::all_of(word.begin() + colon + 1, word.end(),
+		     [](unsigned char c) { return std::isxdigit(c); }))
+	return false;
+
+    // Otherwise it's a filename that happens to have a colon, like build:20240101
+    return EVP_get_digestbyname(std::string(word.substr(0, colon)).c_str()) != nullptr;
+}
+
+
+hasher::hasher(const std::string &spec)
+    : ctx(EVP_MD_CTX_new())
+{
+    md = find_algorithm(spec, &expected);
+    reset();
+}
+
+
+hasher::~hasher()
+{
+    EVP_MD_CTX_free(ctx);
+}
+
+
+void hasher::reset()
+{
+    EVP_DigestInit_ex(ctx, md, nullptr);
+    hashed = 0;
+}
+
+
+void hasher::update(const char *data, size_t len)
+{
+    EVP_DigestUpdate(ctx, data, len);
+    hashed += len;
+}
+
+
+bool hasher::update_from_file(const std::string &fullpath, long long length)
+{
+    int fd = open(fullpath.c_str(), O_RDONLY);
+    if (fd < 0)
+	return false;
+    posix_fadvise(fd, 0, length, POSIX_FADV_SEQUENTIAL);
+
+    std::vector<char> buf(READ_SIZE);
+    long long left = length - hashed;
+    while (left > 0) {
+	ssize_t n = pread(fd, buf.data(), std::min<long long>(left, READ_SIZE), hashed);
+	if (n <= 0)
+	    break;
+	update(buf.data(), n);
+	left -= n;
+    }
+    close(fd);
+
+    return left == 0;
+}
+
+
+bool hasher::verify(const std::string &fullpath)
+{
+    struct stat st;
+    if (stat(fullpath.c_str(), &st) != 0)
+	return false;
+
+    // Hashing only ever went in order, so if it fell short it has to start over
+    if (hashed != st.st_size) {
+	reset();
+	if (!update_from_file(fullpath, st.st_size))
+	    return false;
+    }
+
+    unsigned char value[EVP_MAX_MD_SIZE];
+    unsigned int size = 0;
+    EVP_DigestFinal_ex(ctx, value, &size);
+
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    for (unsigned int i = 0; i < size; i++) {
+	hex += digits[value[i] >> 4];
+	hex += digits[value[i] & 0xf];
+    }
+
+    return hex == expected;
+}
+
+
+/* The algorithm of spec, with the lowercase hex digest going into hex */
+static const EVP_MD *find_algorithm(const std::string &spec, std::string *hex)
+{
+    size_t colon = spec.find(':');
+    if (colon == std::string::npos || !digest::looks_like(spec))
+	return nullptr;
+
+    *hex = spec.substr(colon + 1);
+    std::transform(hex->begin(), hex->end(), hex->begin(),
+		   [](unsigned char c) { return std::tolower(c); });
+
+    return EVP_get_digestbyname(spec.substr(0, colon).c_str());
+}
@@ -0,0 +1,56 @@
+#ifndef DIGEST_H
+#define DIGEST_H
+
+#include <openssl/types.h>
+#include <string>
+#include <string_view>
+
+/*
+ * Checksums for downloads that come with an expected digest, written as
+ * <algorithm>:<hex>, like sha256:9f86d08... Any digest OpenSSL knows by name
+ * works, sha256 being the usual one. The data is hashed as it passes through
+ * the sink, so a finished file doesn't have to be read back to check it.
+ */
+namespace digest {
+    /* Whether spec is an expected digest we can check */
+    bool valid(const std::string &spec);
+    /*
+     * Whether word is meant as a digest, even if not one we can check: a
+     * name OpenSSL knows, a colon and some hex digits
+     */
+    bool looks_like(std::string_view word);
+
+    class hasher {
+    public:
+	/* spec must be valid() */
+	explicit hasher(const std::string &spec);
+	~hasher();
+	hasher(const hasher &) = delete;
+	hasher &operator=(const hasher &) = delete;
+
+	/* Starts over, for a file that's downloaded from scratch */
+	void reset();
+	/* Hashes the next len bytes of the file */
+	void update(const char *data, size_t len);
+	/*
+	 * Hashes the first length bytes of the file at fullpath, the part
+	 * that's already there when it's resumed. Returns false if it
+	 * couldn't be read.
+	 */
+	bool update_from_file(const std::string &fullpath, long long length);
+	/*
+	 * Finishes the hash of the file at fullpath and compares it to the
+	 * expected digest. Whatever wasn't hashed on the way in, like the
+	 * ranges of a segmented download, is read back from the file first.
+	 */
+	bool verify(const std::string &fullpath);
+
+    private:
+	const EVP_MD *md;
+	EVP_MD_CTX *ctx;
+	std::string expected;  // Lowercase hex
+	long long hashed = 0;  // Bytes of the file hashed so far
+    };
+}
+
+#endif
@@ -0,0 +1,448 @@
+#include "engine.h"
+#include "handlepool.h"
+#include "logger.h"
+#include "options.h"
+#include "ratelimit.h"
+#include "writer.h"
+
+#include <algorithm>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Max number of epoll events handled per loop iteration
+#define MAX_EVENTS 256
+// How often to look for new queue entries while the queue is still open
+#define QUEUE_POLL_MS 100
+// Recent times to the first byte the hedge delay is worked out from
+#define HEDGE_SAMPLES 1000
+// And how many new ones it takes to work it out again, and to start hedging
+#define HEDGE_UPDATE 20
+// Never hedge sooner than this, however fast the server usually is
+#define HEDGE_MIN_DELAY_MS 10
+
+
+engine::engine(size_t max_transfers, long max_streams)
+    : max_transfers(max_transfers > 0 ? max_transfers : 1)
+{
+    /*
+     * Every transfer needs a socket and a file, so raise the soft limit on
+     * open files as far as we're allowed to.
+     */
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+	rl.rlim_cur = rl.rlim_max;
+	setrlimit(RLIMIT_NOFILE, &rl);
+    }
+
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = timerfd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, timerfd, &ev);
+    // Buffers came back for transfers paused waiting for one
+    if (writer::wake_fd() >= 0) {
+	ev.data.fd = writer::wake_fd();
+	epoll_ctl(epfd, EPOLL_CTL_ADD, writer::wake_fd(), &ev);
+    }
+
+    multi = curl_multi_init();
+    curl_multi_setopt(multi, CURLMOPT_SOCKETFUNCTION, socket_callback);
+    curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, timer_callback);
+    curl_multi_setopt(multi, CURLMOPT_TIMERDATA, this);
+    curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    if (max_streams > 0)
+	curl_multi_setopt(multi, CURLMOPT_MAX_CONCURRENT_STREAMS, max_streams);
+}
+
+
+engine::~engine()
+{
+    curl_multi_cleanup(multi);
+    close(timerfd);
+    close(epfd);
+}
+
+
+/*
+ * Downloads everything in queue, with at most max_transfers in flight
+ * at the same time. Returns once the queue is closed and drained.
+ */
+void engine::run(workqueue &queue)
+{
+    epoll_event events[MAX_EVENTS];
+    urldata data;
+    bool more = true;
+    int running = 0;
+
+    this->queue = &queue;
+
+    while (more || active > 0) {
+	// Fill the free slots, only blocking on the queue when we're idle
+	while (more && active < max_transfers) {
+	    if (active == 0)
+		more = queue.pop(0, data);
+	    else if (!queue.try_pop(0, data))
+		break;
+	    if (more)
+		submit(data);
+	}
+	if (active == 0)
+	    continue;
+
+	// Wake up in time for transfers paused by the rate limit
+	int timeout = more ? QUEUE_POLL_MS : -1;
+	long wakeup = ratelimit::next_wakeup();
+	if (wakeup >= 0 && (timeout < 0 || wakeup < timeout))
+	    timeout = static_cast<int>(wakeup);
+	// And for the next retry that's due
+	if (!waiting.empty()) {
+	    auto due = std::chrono::duration_cast<std::chrono::milliseconds>(
+		waiting.begin()->first - std::chrono::steady_clock::now()).count() + 1;
+	    if (due < 0)
+		due = 0;
+	    if (timeout < 0 || due < timeout)
+		timeout = static_cast<int>(due);
+	}
+	// And for the next request to hedge
+	long hedge = hedge_wait();
+	if (hedge >= 0 && (timeout < 0 || hedge < timeout))
+	    timeout = static_cast<int>(hedge);
+
+	int n = epoll_wait(epfd, events, MAX_EVENTS, timeout);
+	for (int i = 0; i < n; i++) {
+	    if (events[i].data.fd == timerfd) {
+		uint64_t expirations;
+		if (read(timerfd, &expirations, sizeof(expirations)) > 0)
+		    curl_multi_socket_action(multi, CURL_SOCKET_TIMEOUT, 0, &running);
+	    } else if (events[i].data.fd == writer::wake_fd()) {
+		writer::wake();
+	    } else {
+		int flags = 0;
+		if (events[i].events & EPOLLIN)
+		    flags |= CURL_CSELECT_IN;
+		if (events[i].events & EPOLLOUT)
+		    flags |= CURL_CSELECT_OUT;
+		if (events[i].events & (EPOLLERR | EPOLLHUP))
+		    flags |= CURL_CSELECT_ERR;
+		curl_multi_socket_action(multi, events[i].data.fd, flags, &running);
+	    }
+	}
+
+	ratelimit::wake();
+	check_done();
+	settle_races();
+	start_due();
+	start_hedges();
+    }
+}
+
+
+void engine::report() const
+{
+    if (opts.hedge <= 0 || requests == 0)
+	return;
+
+    log(info[HEDGE_INFO_REQUESTS], {{"requests", requests}, {"hedged", hedged}, {"won", won},
+				    {"delay_ms", hedge_delay / 1000}});
+}
+
+
+/* Starts a download on a handle from the pool */
+void engine::submit(const urldata &data)
+{
+    if (data.url.empty()) {
+	log(err[URL_ERR_EMPTY]);
+	queue->finished(0, data.url);
+	return;
+    }
+
+    CURL *curl = handlepool::acquire();
+    if (!curl) {
+	log(err[FILE_ERR_DOWNLOAD], data.filename);
+	queue->finished(0, data.url);
+	return;
+    }
+
+    active++;
+    step(new transfer(curl, data.url, *data.path, data.filename, data.checksum));
+}
+
+
+/* Puts the next request of t on the loop, or finishes t if it's done */
+void engine::step(transfer *t)
+{
+    if (t->next()) {
+	// next() resets the handle between requests, so this is set every time
+	curl_easy_setopt(t->handle(), CURLOPT_PRIVATE, t);
+	long delay = t->delay();
+	if (delay > 0)
+	    waiting.emplace(std::chrono::steady_clock::now() + std::chrono::milliseconds(delay), t);
+	else
+	    add(t->handle());
+    } else
+	finish(t);
+}
+
+
+/* Reports the result of t and frees its slot */
+void engine::finish(transfer *t)
+{
+    if (!t->result())
+	log(err[FILE_ERR_DOWNLOAD], t->get_filename());
+
+    handlepool::release(t->handle());
+    queue->finished(0, t->get_url());
+    delete t;
+    active--;
+}
+
+
+/* Moves every request curl reports as completed on to its next step */
+void engine::check_done()
+{
+    CURLMsg *msg;
+    int left;
+
+    while ((msg = curl_multi_info_read(multi, &left))) {
+	if (msg->msg != CURLMSG_DONE)
+	    continue;
+
+	// msg is invalid once the handle is removed
+	CURL *curl = msg->easy_handle;
+	CURLcode res = msg->data.result;
+	transfer *t = nullptr;
+
+	curl_easy_getinfo(curl, CURLINFO_PRIVATE, &t);
+	curl_multi_remove_handle(multi, curl);
+	ratelimit::forget(curl);
+	writer::forget(curl);
+	answered(curl);
+	if (t->get_rival() && !finish_race(t, curl, res))
+	    continue;
+	if (res == CURLE_OK)
+	    sample(curl);
+	t->done(res);
+	step(t);
+    }
+}
+
+
+/* Puts the retries that have waited long enough on the loop */
+void engine::start_due()
+{
+    auto now = std::chrono::steady_clock::now();
+
+    while (!waiting.empty() && waiting.begin()->first <= now) {
+	add(waiting.begin()->second->handle());
+	waiting.erase(waiting.begin());
+    }
+}
+
+
+/* Puts a request on the loop, to be hedged if it's slow to answer */
+void engine::add(CURL *curl)
+{
+    curl_multi_add_handle(multi, curl);
+    requests++;
+    if (opts.hedge > 0)
+	sent_at[curl] = sent.emplace(std::chrono::steady_clock::now(), curl);
+}
+
+
+/* Stops considering curl for a hedge */
+void engine::answered(CURL *curl)
+{
+    auto it = sent_at.find(curl);
+    if (it == sent_at.end())
+	return;
+
+    sent.erase(it->second);
+    sent_at.erase(it);
+}
+
+
+/*
+ * Adds how long curl waited for its first byte to the ones the hedge delay
+ * is worked out from: the time all but opts.hedge percent of them beat.
+ */
+void engine::sample(CURL *curl)
+{
+    curl_off_t first_byte = 0;
+
+    if (opts.hedge <= 0 || curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &first_byte) != CURLE_OK
+	|| first_byte <= 0)
+	return;
+
+    if (first_bytes.size() < HEDGE_SAMPLES)
+	first_bytes.push_back(first_byte);
+    else
+	first_bytes[samples % HEDGE_SAMPLES] = first_byte;
+    if (++samples % HEDGE_UPDATE != 0)
+	return;
+
+    std::vector<curl_off_t> sorted(first_bytes);
+    size_t nth = std::min(sorted.size() - 1,
+			  static_cast<size_t>(sorted.size() * (100 - opts.hedge) / 100));
+    std::nth_element(sorted.begin(), sorted.begin() + nth, sorted.end());
+    hedge_delay = std::max<long long>(sorted[nth], HEDGE_MIN_DELAY_MS * 1000LL);
+}
+
+
+/* Whether another hedge stays within opts.hedge percent of the requests */
+bool engine::can_hedge() const
+{
+    return hedge_delay >= 0 && (hedged + 1) * 100 <= opts.hedge * requests;
+}
+
+
+/* Milliseconds until the next request is due for a hedge, or -1 if none is */
+long engine::hedge_wait() const
+{
+    if (sent.empty() || !can_hedge())
+	return -1;
+
+    auto due = sent.begin()->first + std::chrono::microseconds(hedge_delay);
+    long wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+	due - std::chrono::steady_clock::now()).count() + 1;
+
+    return wait > 0 ? wait : 0;
+}
+
+
+/* Sends the requests that waited past the hedge delay for a response again */
+void engine::start_hedges()
+{
+    auto due = std::chrono::steady_clock::now() - std::chrono::microseconds(hedge_delay);
+
+    while (!sent.empty() && can_hedge() && sent.begin()->first <= due) {
+	CURL *curl = sent.begin()->second;
+	transfer *t = nullptr;
+	long header_size = 0;
+
+	answered(curl);
+	// Only requests that haven't heard back at all, the rest are on their way
+	curl_easy_getinfo(curl, CURLINFO_HEADER_SIZE, &header_size);
+	if (header_size > 0)
+	    continue;
+
+	CURL *rival = handlepool::duplicate(curl);
+	if (!rival)
+	    continue;
+	// On a connection of its own, not as another stream next to the slow one
+	if (opts.http_version != CURL_HTTP_VERSION_NONE) {
+	    curl_easy_setopt(rival, CURLOPT_FRESH_CONNECT, 1L);
+	    curl_easy_setopt(rival, CURLOPT_PIPEWAIT, 0L);
+	}
+	curl_easy_getinfo(curl, CURLINFO_PRIVATE, &t);
+	t->hedge(rival);
+	curl_multi_add_handle(multi, rival);
+	racing.emplace_back(t, rival);
+	hedged++;
+    }
+}
+
+
+/* Takes the losers of the races that were decided off the loop */
+void engine::settle_races()
+{
+    for (size_t i = 0; i < racing.size(); ) {
+	transfer *t = racing[i].first;
+	if (!t->race_decided()) {
+	    i++;
+	    continue;
+	}
+	if (t->handle() == racing[i].second)
+	    won++;
+	drop(t, t->get_rival());
+	racing[i] = racing.back();
+	racing.pop_back();
+    }
+}
+
+
+/*
+ * Ends the race of t now that curl, one of its handles, finished with res.
+ * Returns false if the other one carries on: curl lost, or failed before
+ * either got a response.
+ */
+bool engine::finish_race(transfer *t, CURL *curl, CURLcode res)
+{
+    auto it = std::find_if(racing.begin(), racing.end(),
+			   [t](const std::pair<transfer *, CURL *> &r) { return r.first == t; });
+    CURL *added = it->second;
+    racing.erase(it);
+
+    if (t->race_decided() && t->handle() == added)
+	won++;
+    if (curl != t->handle() || (!t->race_decided() && res != CURLE_OK)) {
+	t->end_race(curl);
+	handlepool::release(curl);
+	return false;
+    }
+
+    drop(t, t->get_rival());
+    return true;
+}
+
+
+/* Takes loser, the handle that lost the race for t, off the loop */
+void engine::drop(transfer *t, CURL *loser)
+{
+    curl_multi_remove_handle(multi, loser);
+    ratelimit::forget(loser);
+    writer::forget(loser);
+    answered(loser);
+    t->end_race(loser);
+    handlepool::release(loser);
+}
+
+
+/* CURLMOPT_SOCKETFUNCTION: keeps the epoll set in sync with curl's sockets */
+int engine::socket_callback(CURL *easy, curl_socket_t s, int what,
+			    void *userp, void *socketp)
+{
+    engine *e = static_cast<engine *>(userp);
+
+    if (what == CURL_POLL_REMOVE) {
+	epoll_ctl(e->epfd, EPOLL_CTL_DEL, s, nullptr);
+	return 0;
+    }
+
+    epoll_event ev = {};
+    ev.data.fd = s;
+    if (what & CURL_POLL_IN)
+	ev.events |= EPOLLIN;
+    if (what & CURL_POLL_OUT)
+	ev.events |= EPOLLOUT;
+
+    if (epoll_ctl(e->epfd, EPOLL_CTL_MOD, s, &ev) < 0)
+	epoll_ctl(e->epfd, EPOLL_CTL_ADD, s, &ev);
+
+    return 0;
+}
+
+
+/* CURLMOPT_TIMERFUNCTION: arms the timerfd with curl's next timeout */
+int engine::timer_callback(CURLM *multi, long timeout_ms, void *userp)
+{
+    engine *e = static_cast<engine *>(userp);
+    itimerspec its = {};
+
+    if (timeout_ms > 0) {
+	its.it_value.tv_sec = timeout_ms / 1000;
+	its.it_value.tv_nsec = (timeout_ms % 1000) * 1000000;
+    } else if (timeout_ms == 0) {
+	// Fire as soon as possible. All zeros would disarm the timer
+	its.it_value.tv_nsec = 1;
+    }
+    // -1 leaves its zeroed, which disarms the timer
+
+    timerfd_settime(e->timerfd, 0, &its, nullptr);
+
+    return 0;
+}
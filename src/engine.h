@@ -0,0 +1,87 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "curler.h"
+#include "queue.h"
+
+#include <chrono>
+#include <curl/curl.h>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Single-threaded event loop that drives many downloads at once on a curl
+ * multi handle. Sockets are watched with epoll and curl's timeouts with a
+ * timerfd, and both are fed to curl_multi_socket_action(), so the cost per
+ * loop iteration depends on the sockets that are ready rather than on the
+ * number of transfers in flight.
+ *
+ * Transfers to a host that speaks HTTP/2 are multiplexed over as few
+ * connections as the stream limit allows, instead of one connection each.
+ *
+ * With --hedge, a request still waiting for its response after most of the
+ * recent ones had theirs is sent again, and whichever copy answers first
+ * is kept (see transfer::hedge()).
+ */
+class engine {
+public:
+    /*
+     * max_streams is the most transfers to multiplex over one HTTP/2
+     * connection, 0 for curl's default
+     */
+    engine(size_t max_transfers, long max_streams);
+    ~engine();
+
+    /*
+     * Downloads everything in queue, with at most max_transfers in flight
+     * at the same time. Returns once the queue is closed and drained.
+     */
+    void run(workqueue &queue);
+    /* Logs how many requests were hedged, and how many of those won */
+    void report() const;
+
+private:
+    void submit(const urldata &data);
+    void step(transfer *t);
+    void finish(transfer *t);
+    void check_done();
+    void start_due();
+    void add(CURL *curl);
+    void answered(CURL *curl);
+    void sample(CURL *curl);
+    bool can_hedge() const;
+    long hedge_wait() const;
+    void start_hedges();
+    void settle_races();
+    bool finish_race(transfer *t, CURL *curl, CURLcode res);
+    void drop(transfer *t, CURL *loser);
+
+    static int socket_callback(CURL *easy, curl_socket_t s, int what,
+			       void *userp, void *socketp);
+    static int timer_callback(CURLM *multi, long timeout_ms, void *userp);
+
+    CURLM *multi;
+    int epfd;
+    int timerfd;
+    size_t max_transfers;
+    size_t active = 0;
+    // Retries backing off, by when they're due. They count as active
+    std::multimap<std::chrono::steady_clock::time_point, transfer *> waiting;
+    workqueue *queue = nullptr;  // The one being run
+
+    // Requests that may still be hedged, by when they were put on the loop
+    std::multimap<std::chrono::steady_clock::time_point, CURL *> sent;
+    std::unordered_map<CURL *, decltype(sent)::iterator> sent_at;
+    // Transfers racing a second request, with the handle added for it
+    std::vector<std::pair<transfer *, CURL *>> racing;
+    std::vector<curl_off_t> first_bytes;  // Recent times to the first byte, in microseconds
+    long long samples = 0;       // Times to the first byte seen in all
+    long long hedge_delay = -1;  // Microseconds before a request is hedged, -1 until known
+    long long requests = 0;
+    long long hedged = 0;
+    long long won = 0;           // Hedges that answered before the request they raced
+};
+
+#endif
@@ -1,65 +1,141 @@
 #include "fileops.h"
 
 #include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
 #include <filesystem>
+#include <mutex>
 #include <string>
+#include <string.h>
 #include <sys/stat.h>
-#include <utime.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Lookups in one directory before it's listed and indexed
+#define INDEX_AFTER 64
+// Buffer for getdents64(). Large, so listing a big directory over NFS takes few round trips
+#define LIST_SIZE (1024 * 1024)
 
 namespace fs = std::filesystem;
 
 using namespace fileops;
 
+/* What we know about one directory files are looked up in */
+struct directory {
+    size_t lookups = 0;
+    bool indexed = false;  // names holds everything in it
+    int writeable = -1;    // -1 until checked
+    std::unordered_set<std::string> names;
+};
+
+static std::mutex dirs_mtx;  // Guards dirs and everything in them
+static std::unordered_map<std::string, directory> dirs;
+
+static int indexed_exists(const std::string &filename);
+static void split(const std::string &filename, std::string *dir, std::string *name);
+static std::string dir_key(const std::string &path);
+static bool list_dir(const std::string &dir, std::unordered_set<std::string> &names);
+static bool stat_path(const std::string &path, unsigned int mask, struct statx *stx);
+
 void fileops::create_dir_if_not_exists(const std::string path) {
     if (!fs::is_directory(path) || !fs::exists(path))
 	fs::create_directory(path);
 }
 
-bool fileops::is_writeable(const std::string path) {
-    fs::perms p = fs::status(path).permissions();
-    if ((p & fs::perms::owner_write) != fs::perms::none)
-	return true;
-    return false;
+
+/* Whether the directory at path is writeable. Checked once per directory and run */
+bool fileops::is_writeable(const std::string &path)
+{
+    std::string key = dir_key(path);
+    {
+	std::lock_guard<std::mutex> lock(dirs_mtx);
+	auto it = dirs.find(key);
+	if (it != dirs.end() && it->second.writeable >= 0)
+	    return it->second.writeable;
+    }
+
+    // A path that isn't there is left for opening the file to fail on
+    struct statx stx;
+    bool writeable = !stat_path(path, STATX_MODE, &stx) || (stx.stx_mode & S_IWUSR);
+
+    std::lock_guard<std::mutex> lock(dirs_mtx);
+    dirs[key].writeable = writeable;
+
+    return writeable;
 }
 
-bool fileops::file_exists(const std::string &filename) {
-    return fs::exists(filename);
+
+bool fileops::file_exists(const std::string &filename)
+{
+    int known = indexed_exists(filename);
+    if (known >= 0)
+	return known;
+
+    struct statx stx;
+    return stat_path(filename, 0, &stx);
 }
 
 
-std::uintmax_t fileops::get_filesize(const std::string &filename) {
-    return fs::file_size(filename);
+/* Everything we need to know about the file at filename, in one go */
+fileinfo fileops::lookup(const std::string &filename)
+{
+    fileinfo info;
+    struct statx stx;
+
+    if (indexed_exists(filename) == 0
+	|| !stat_path(filename, STATX_TYPE | STATX_SIZE | STATX_MTIME, &stx))
+	return info;
+
+    info.exists = true;
+    info.regular = S_ISREG(stx.stx_mode);
+    info.size = stx.stx_size;
+    info.mtime = stx.stx_mtime.tv_sec;
+
+    return info;
 }
 
 
-/* Sets the file modification time to filetime */
-bool fileops::set_filetime(const std::string &filename, const time_t filetime)
+/* Tells the directory index that filename was created, or renamed to */
+void fileops::created(const std::string &filename)
 {
-    struct stat buffer;
-    struct utimbuf new_time;
+    std::string dir, name;
+    split(filename, &dir, &name);
 
-    if (stat(filename.c_str(), &buffer) < 0)
-	return false;
+    std::lock_guard<std::mutex> lock(dirs_mtx);
+    auto it = dirs.find(dir);
+    if (it != dirs.end() && it->second.indexed)
+	it->second.names.insert(name);
+}
 
-    new_time.actime = buffer.st_atime;
-    new_time.modtime = filetime;
-    if (utime(filename.c_str(), &new_time) < 0)
-	return false;
 
-    return true;
+/* Tells the directory index that filename was removed, or renamed away */
+void fileops::removed(const std::string &filename)
+{
+    std::string dir, name;
+    split(filename, &dir, &name);
+
+    std::lock_guard<std::mutex> lock(dirs_mtx);
+    auto it = dirs.find(dir);
+    if (it != dirs.end() && it->second.indexed)
+	it->second.names.erase(name);
 }
 
 
-/* Gets the file modification time from filename */
-time_t fileops::get_filetime(const std::string &filename)
+/* Sets the file modification time to filetime */
+bool fileops::set_filetime(const std::string &filename, const time_t filetime)
 {
-    struct stat buffer;
-    time_t filetime = 0;
+    struct timespec times[2];
 
-    if (stat(filename.c_str(), &buffer) == 0)
-	filetime = buffer.st_mtime;
+    // Leaves the access time as it is, without having to stat for it
+    times[0].tv_sec = 0;
+    times[0].tv_nsec = UTIME_OMIT;
+    times[1].tv_sec = filetime;
+    times[1].tv_nsec = 0;
 
-    return filetime;
+    return utimensat(AT_FDCWD, filename.c_str(), times, 0) == 0;
 }
 
 
@@ -86,3 +162,120 @@ std::string fileops::clean_filename(const std::string &filename)
 
     return clean_name;
 }
+
+
+/* Bytes available to us on the filesystem holding path, or -1 if unknown */
+long long fileops::get_free_space(const std::string &path)
+{
+    struct statvfs buffer;
+
+    if (statvfs(path.c_str(), &buffer) < 0)
+	return -1;
+
+    return static_cast<long long>(buffer.f_bavail) * buffer.f_frsize;
+}
+
+
+/*
+ * Allocates length bytes from offset in the file up front. With
+ * keep_size the blocks are reserved without changing the file size.
+ */
+bool fileops::preallocate(int fd, long long offset, long long length, bool keep_size)
+{
+    /*
+     * Not posix_fallocate(), which falls back on writing zeros to the whole
+     * range on filesystems without fallocate support.
+     */
+    return fallocate(fd, keep_size ? FALLOC_FL_KEEP_SIZE : 0, offset, length) == 0;
+}
+
+
+/*
+ * Whether filename exists according to the index of its directory: 1 if it
+ * does, 0 if it doesn't, or -1 if the directory isn't indexed. Lists the
+ * directory once it's been asked about often enough.
+ *
+ * The listing is done with dirs_mtx held. Files are reported to created()
+ * and removed() after the fact, so a change either made it into the listing
+ * or is reported once it's done.
+ */
+static int indexed_exists(const std::string &filename)
+{
+    std::string dir, name;
+    split(filename, &dir, &name);
+
+    std::lock_guard<std::mutex> lock(dirs_mtx);
+    directory &d = dirs[dir];
+    if (!d.indexed && ++d.lookups >= INDEX_AFTER) {
+	d.indexed = list_dir(dir, d.names);
+	// Not there or not readable, so try again in a while
+	if (!d.indexed)
+	    d.lookups = 0;
+    }
+    if (!d.indexed)
+	return -1;
+
+    return d.names.count(name) > 0;
+}
+
+
+/* Splits filename into its directory, as a key for dirs, and its name */
+static void split(const std::string &filename, std::string *dir, std::string *name)
+{
+    size_t slash = filename.rfind('/');
+
+    if (slash == std::string::npos) {
+	*dir = ".";
+	*name = filename;
+    } else {
+	*dir = dir_key(filename.substr(0, slash + 1));
+	*name = filename.substr(slash + 1);
+    }
+}
+
+
+/* path without the trailing slashes, so a directory always has the same key */
+static std::string dir_key(const std::string &path)
+{
+    size_t end = path.find_last_not_of('/');
+
+    if (end == std::string::npos)
+	return path.empty() ? "." : "/";
+
+    return path.substr(0, end + 1);
+}
+
+
+/* Reads the names of everything in dir into names. Returns false if it can't be listed */
+static bool list_dir(const std::string &dir, std::unordered_set<std::string> &names)
+{
+    int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+	return false;
+
+    std::vector<char> buf(LIST_SIZE);
+    names.clear();
+    for (;;) {
+	ssize_t n = getdents64(fd, buf.data(), buf.size());
+	if (n <= 0) {
+	    close(fd);
+	    if (n < 0)
+		names.clear();
+	    return n == 0;
+	}
+
+	for (ssize_t off = 0; off < n;) {
+	    const struct dirent64 *ent = reinterpret_cast<const struct dirent64 *>(buf.data() + off);
+	    if (strcmp(ent->d_name, ".") != 0 && strcmp(ent->d_name, "..") != 0)
+		names.emplace(ent->d_name);
+	    off += ent->d_reclen;
+	}
+    }
+}
+
+
+/* statx() for the fields in mask. Returns false if there's nothing at path */
+static bool stat_path(const std::string &path, unsigned int mask, struct statx *stx)
+{
+    return statx(AT_FDCWD, path.c_str(), 0, mask, stx) == 0;
+}
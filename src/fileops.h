@@ -1,19 +1,49 @@
 #ifndef FILEOPS_H
 #define FILEOPS_H
 
+#include <ctime>
 #include <string>
 
+/* What a single statx() found at a path */
+struct fileinfo {
+    bool exists = false;
+    bool regular = false;  // A regular file, not a directory or anything else
+    long long size = 0;
+    time_t mtime = 0;
+};
+
+/*
+ * Once a run has looked up enough paths in one directory, the directory is
+ * listed with a single getdents64() scan, and from then on whether a path in
+ * it exists is answered from that index. Only paths that do exist cost a
+ * statx(), so a new download into a directory of 200k files doesn't cost a
+ * round trip to the server. The index is kept up to date with created() and
+ * removed(), so everything curler creates, renames or deletes in the output
+ * directories has to be reported there. Files put there by others during
+ * the run aren't seen.
+ */
 namespace fileops {
     void create_dir_if_not_exists(const std::string path);
-    bool is_writeable(const std::string path);
+    /* Whether the directory at path is writeable. Checked once per directory and run */
+    bool is_writeable(const std::string &path);
     bool file_exists(const std::string &filename);
-    std::uintmax_t get_filesize(const std::string &filename);
+    /* Everything we need to know about the file at filename, in one go */
+    fileinfo lookup(const std::string &filename);
+    /* Tells the directory index that filename was created, or renamed to */
+    void created(const std::string &filename);
+    /* Tells the directory index that filename was removed, or renamed away */
+    void removed(const std::string &filename);
     /* Sets the file modification time to filetime */
     bool set_filetime(const std::string &filename, const time_t filetime);
-    /* Gets the file modification time from filename */
-    time_t get_filetime(const std::string &filename);
     /* Remove any illegal characters from filename */
     std::string clean_filename(const std::string &filename);
+    /* Bytes available to us on the filesystem holding path, or -1 if unknown */
+    long long get_free_space(const std::string &path);
+    /*
+     * Allocates length bytes from offset in the file up front. With
+     * keep_size the blocks are reserved without changing the file size.
+     */
+    bool preallocate(int fd, long long offset, long long length, bool keep_size);
 }
 
 #endif
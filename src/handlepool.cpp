@@ -0,0 +1,177 @@
+#include "handlepool.h"
+#include "logger.h"
+#include "options.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+static CURLSH *share = nullptr;
+static long cache_size = 5;  // curl's own default
+static std::mutex share_mtx[CURL_LOCK_DATA_LAST];
+static std::mutex pool_mtx;
+static std::vector<CURL *> pool;
+static std::atomic<long> requests{0};
+static std::atomic<long> reused{0};
+
+
+/* Attaches curl to the caches and sets what every request shares */
+static void attach(CURL *curl)
+{
+    curl_easy_setopt(curl, CURLOPT_SHARE, share);
+    curl_easy_setopt(curl, CURLOPT_MAXCONNECTS, cache_size);
+
+    // A connection that has gone quiet fails the request, which is then retried
+    if (opts.speed_time > 0) {
+	curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, opts.speed_limit);
+	curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, opts.speed_time);
+    }
+
+    if (opts.http_version != CURL_HTTP_VERSION_NONE) {
+	curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, opts.http_version);
+	/*
+	 * Wait for a connection that's still being set up to tell whether it
+	 * can multiplex, rather than opening one of our own next to it. This
+	 * is what keeps a burst of requests to one host on one connection.
+	 */
+	curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    }
+}
+
+
+/* CURLSHOPT_LOCKFUNCTION: the caches are used from several threads */
+static void lock_callback(CURL *curl, curl_lock_data data, curl_lock_access access,
+			  void *userptr)
+{
+    share_mtx[data].lock();
+}
+
+
+/* CURLSHOPT_UNLOCKFUNCTION */
+static void unlock_callback(CURL *curl, curl_lock_data data, void *userptr)
+{
+    share_mtx[data].unlock();
+}
+
+
+/*
+ * max_connections is how many idle connections the cache may keep open.
+ * shared_connections is only for handles that are all driven from one
+ * thread, like the event engine's.
+ */
+void handlepool::init(long max_connections, bool shared_connections)
+{
+    share = curl_share_init();
+    curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lock_callback);
+    curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlock_callback);
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    /*
+     * libcurl doesn't support a connection cache used by several threads at
+     * once, locks or not, so workers and segment threads keep the one of the
+     * handle they're on, which stays with the handle between downloads.
+     */
+    if (!shared_connections)
+	return;
+
+    /*
+     * The cache closes the oldest connection when a handle leaves one more
+     * behind than this, so it has to fit a connection for every transfer
+     * that can run at the same time.
+     */
+    if (max_connections > cache_size)
+	cache_size = max_connections;
+    curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+}
+
+
+void handlepool::cleanup()
+{
+    // The handles have to go before the share they're attached to
+    for (CURL *curl : pool)
+	curl_easy_cleanup(curl);
+    pool.clear();
+
+    curl_share_cleanup(share);
+    share = nullptr;
+}
+
+
+/* Gets a handle from the pool, creating one if the pool is empty */
+CURL *handlepool::acquire()
+{
+    {
+	std::lock_guard<std::mutex> lock(pool_mtx);
+	if (!pool.empty()) {
+	    CURL *curl = pool.back();
+	    pool.pop_back();
+	    return curl;
+	}
+    }
+
+    CURL *curl = curl_easy_init();
+    if (curl)
+	attach(curl);
+
+    return curl;
+}
+
+
+/* Resets curl and puts it back in the pool */
+void handlepool::release(CURL *curl)
+{
+    if (!curl)
+	return;
+
+    reset(curl);
+    std::lock_guard<std::mutex> lock(pool_mtx);
+    pool.push_back(curl);
+}
+
+
+/*
+ * Makes a new handle set up for the same request as curl, attached to the
+ * caches like the others. Goes back to the pool with release()
+ */
+CURL *handlepool::duplicate(CURL *curl)
+{
+    // A copy isn't attached to anything it shared
+    CURL *dup = curl_easy_duphandle(curl);
+    if (dup)
+	attach(dup);
+
+    return dup;
+}
+
+
+/* Resets curl to its defaults, but keeps it attached to the caches */
+void handlepool::reset(CURL *curl)
+{
+    curl_easy_reset(curl);
+    attach(curl);
+}
+
+
+/* Counts a finished request on curl towards the connection reuse rate */
+void handlepool::record(CURL *curl)
+{
+    long new_connections = 0;
+
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &new_connections);
+    requests++;
+    if (new_connections == 0)
+	reused++;
+}
+
+
+/* Logs how many requests reused a connection */
+void handlepool::report()
+{
+    if (requests == 0)
+	return;
+
+    long percent = reused * 100 / requests;
+    log(info[POOL_INFO_REUSE], {{"requests", requests.load()}, {"reused", reused.load()}, {"percent", percent}});
+}
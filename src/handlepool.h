@@ -0,0 +1,40 @@
+#ifndef HANDLEPOOL_H
+#define HANDLEPOOL_H
+
+#include <curl/curl.h>
+
+/*
+ * Process-wide pool of curl handles. Every handle is attached to one shared
+ * DNS cache and TLS session cache. On the event engine they share the
+ * connection cache too, so a download can pick up a connection left warm by
+ * any earlier download to the same host. Handles used from several threads
+ * (-j, -s) each keep their own connections instead, which libcurl requires.
+ * The handles also carry the options that go for every request: the HTTP
+ * version, and when to give up on one that has stalled.
+ */
+namespace handlepool {
+    /*
+     * max_connections is how many idle connections the cache may keep open.
+     * shared_connections is only for handles that are all driven from one
+     * thread, like the event engine's.
+     */
+    void init(long max_connections, bool shared_connections);
+    void cleanup();
+    /* Gets a handle from the pool, creating one if the pool is empty */
+    CURL *acquire();
+    /* Resets curl and puts it back in the pool */
+    void release(CURL *curl);
+    /*
+     * Makes a new handle set up for the same request as curl, attached to
+     * the caches like the others. Goes back to the pool with release()
+     */
+    CURL *duplicate(CURL *curl);
+    /* Resets curl to its defaults, but keeps it attached to the caches */
+    void reset(CURL *curl);
+    /* Counts a finished request on curl towards the connection reuse rate */
+    void record(CURL *curl);
+    /* Logs how many requests reused a connection */
+    void report();
+}
+
+#endif
@@ -0,0 +1,269 @@
+#include "headerparser.h"
+
+#include <string.h>
+#include <string_view>
+
+using std::string_view;
+
+static bool iequals(string_view a, string_view b);
+static string_view trim(string_view s);
+static string_view next_token(string_view &s, char sep);
+static bool parse_number(string_view s, long long *number);
+static void copy_value(char *dst, size_t size, string_view value);
+static size_t unquote(char *dst, size_t size, string_view value);
+static size_t percent_decode(char *buf, size_t length);
+static void parse_content_disposition(string_view value, txt_headers *hdrs);
+static void parse_content_range(string_view value, txt_headers *hdrs);
+static void parse_accept_ranges(string_view value, txt_headers *hdrs);
+
+
+/* Dispatches on the header name. See headerparser.h */
+void parse_header_line(const char *line, size_t length, txt_headers *hdrs)
+{
+    string_view s(line, length);
+
+    if (s.substr(0, 5) == "HTTP/") {
+	char location[sizeof(hdrs->location)];
+	memcpy(location, hdrs->location, sizeof(location));
+	*hdrs = txt_headers();
+	memcpy(hdrs->location, location, sizeof(location));
+	return;
+    }
+
+    size_t colon = s.find(':');
+    if (colon == string_view::npos)
+	return;
+
+    string_view name = trim(s.substr(0, colon));
+    string_view value = trim(s.substr(colon + 1));
+
+    if (iequals(name, "content-disposition"))
+	parse_content_disposition(value, hdrs);
+    else if (iequals(name, "location"))
+	copy_value(hdrs->location, sizeof(hdrs->location), value);
+    else if (iequals(name, "etag"))
+	copy_value(hdrs->etag, sizeof(hdrs->etag), value);
+    else if (iequals(name, "last-modified"))
+	copy_value(hdrs->last_modified, sizeof(hdrs->last_modified), value);
+    else if (iequals(name, "content-encoding"))
+	copy_value(hdrs->content_encoding, sizeof(hdrs->content_encoding), value);
+    else if (iequals(name, "accept-ranges"))
+	parse_accept_ranges(value, hdrs);
+    else if (iequals(name, "content-range"))
+	parse_content_range(value, hdrs);
+}
+
+
+/*
+ * Gets the filename out of a content-disposition value, like
+ *     attachment; filename="a \"b\".txt"; filename*=UTF-8''a%20%22b%22.txt
+ * The RFC 6266 filename* parameter wins over a plain filename, whichever
+ * comes first. Both get percent decoded, since plenty of servers encode
+ * plain filenames too.
+ */
+static void parse_content_disposition(string_view value, txt_headers *hdrs)
+{
+    next_token(value, ';');  // Disposition type
+
+    while (!value.empty()) {
+	string_view param = next_token(value, ';');
+	size_t eq = param.find('=');
+	if (eq == string_view::npos)
+	    continue;
+
+	string_view key = trim(param.substr(0, eq));
+	string_view val = trim(param.substr(eq + 1));
+	char *dst = hdrs->content_disposition;
+	size_t size = sizeof(hdrs->content_disposition);
+
+	if (iequals(key, "filename*")) {
+	    // charset'language'percent-encoded-value
+	    size_t q1 = val.find('\'');
+	    size_t q2 = q1 == string_view::npos ? q1 : val.find('\'', q1 + 1);
+	    if (q2 == string_view::npos)
+		continue;
+	    val = val.substr(q2 + 1);
+	    size_t n = val.length() < size ? val.length() : size - 1;
+	    memcpy(dst, val.data(), n);
+	    dst[percent_decode(dst, n)] = '\0';
+	    hdrs->filename_ext = true;
+	} else if (iequals(key, "filename") && !hdrs->filename_ext) {
+	    size_t n = unquote(dst, size, val);
+	    dst[percent_decode(dst, n)] = '\0';
+	}
+    }
+}
+
+
+/*
+ * Content-range looks like "bytes 0-99/1000", or "bytes 0-99/" followed by
+ * a "*" when the length isn't known, or "bytes " then "*" then "/1000" in
+ * a 416 response.
+ */
+static void parse_content_range(string_view value, txt_headers *hdrs)
+{
+    string_view unit = next_token(value, ' ');
+    if (!iequals(unit, "bytes"))
+	return;
+
+    string_view range = next_token(value, '/');
+    string_view length = trim(value);
+
+    if (range != "*") {
+	size_t dash = range.find('-');
+	if (dash == string_view::npos
+	    || !parse_number(range.substr(0, dash), &hdrs->range_start)
+	    || !parse_number(range.substr(dash + 1), &hdrs->range_end)) {
+	    hdrs->range_start = hdrs->range_end = -1;
+	}
+    }
+    if (length != "*" && !parse_number(length, &hdrs->range_length))
+	hdrs->range_length = -1;
+}
+
+
+/* Accept-ranges is a list of range units, or "none" */
+static void parse_accept_ranges(string_view value, txt_headers *hdrs)
+{
+    hdrs->accept_ranges = false;
+
+    while (!value.empty()) {
+	if (iequals(next_token(value, ','), "bytes"))
+	    hdrs->accept_ranges = true;
+    }
+}
+
+
+/* Compares two strings without regard to ASCII case */
+static bool iequals(string_view a, string_view b)
+{
+    if (a.length() != b.length())
+	return false;
+
+    for (size_t i = 0; i < a.length(); i++) {
+	char ca = a[i], cb = b[i];
+	if (ca >= 'A' && ca <= 'Z')
+	    ca += 'a' - 'A';
+	if (cb >= 'A' && cb <= 'Z')
+	    cb += 'a' - 'A';
+	if (ca != cb)
+	    return false;
+    }
+
+    return true;
+}
+
+
+/* Strips spaces, tabs and line endings from both ends */
+static string_view trim(string_view s)
+{
+    const char *ws = " \t\r\n";
+    size_t start = s.find_first_not_of(ws);
+
+    if (start == string_view::npos)
+	return string_view();
+
+    return s.substr(start, s.find_last_not_of(ws) - start + 1);
+}
+
+
+/*
+ * Returns the trimmed text up to the next sep that isn't inside a quoted
+ * string, and moves s past it.
+ */
+static string_view next_token(string_view &s, char sep)
+{
+    bool quoted = false;
+    size_t i = 0;
+
+    for (; i < s.length(); i++) {
+	if (quoted && s[i] == '\\')
+	    i++;
+	else if (s[i] == '"')
+	    quoted = !quoted;
+	else if (!quoted && s[i] == sep)
+	    break;
+    }
+
+    string_view token = trim(s.substr(0, i));
+    s = i < s.length() ? s.substr(i + 1) : string_view();
+
+    return token;
+}
+
+
+/* Parses a non-negative decimal number. Returns false if s isn't one */
+static bool parse_number(string_view s, long long *number)
+{
+    s = trim(s);
+    if (s.empty() || s.length() > 18)
+	return false;
+
+    long long n = 0;
+    for (char c : s) {
+	if (c < '0' || c > '9')
+	    return false;
+	n = n * 10 + (c - '0');
+    }
+    *number = n;
+
+    return true;
+}
+
+
+/* Copies value into dst as a NUL terminated string, cutting it short if needed */
+static void copy_value(char *dst, size_t size, string_view value)
+{
+    size_t n = value.length() < size ? value.length() : size - 1;
+
+    memcpy(dst, value.data(), n);
+    dst[n] = '\0';
+}
+
+
+/*
+ * Copies value into dst without its surrounding quotes and backslash
+ * escapes, if it's a quoted string. Returns the number of bytes written,
+ * not counting the NUL terminator.
+ */
+static size_t unquote(char *dst, size_t size, string_view value)
+{
+    if (value.length() < 2 || value.front() != '"' || value.back() != '"') {
+	copy_value(dst, size, value);
+	return strlen(dst);
+    }
+
+    size_t n = 0;
+    for (size_t i = 1; i + 1 < value.length() && n + 1 < size; i++) {
+	if (value[i] == '\\' && i + 2 < value.length())
+	    i++;
+	dst[n++] = value[i];
+    }
+    dst[n] = '\0';
+
+    return n;
+}
+
+
+/* Decodes %XX escapes in place. Returns the new length */
+static size_t percent_decode(char *buf, size_t length)
+{
+    auto hex = [](char c) -> int {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+    };
+    size_t n = 0;
+
+    for (size_t i = 0; i < length; i++) {
+	if (buf[i] == '%' && i + 2 < length
+	    && hex(buf[i+1]) >= 0 && hex(buf[i+2]) >= 0) {
+	    buf[n++] = static_cast<char>(hex(buf[i+1]) * 16 + hex(buf[i+2]));
+	    i += 2;
+	} else
+	    buf[n++] = buf[i];
+    }
+
+    return n;
+}
@@ -0,0 +1,18 @@
+#ifndef HEADERPARSER_H
+#define HEADERPARSER_H
+
+#include "callbacks.h"
+
+#include <stddef.h>
+
+/*
+ * Parses one raw header line as handed to CURLOPT_HEADERFUNCTION (not NUL
+ * terminated, CRLF included) into hdrs. Header names are matched without
+ * regard to case, and nothing is allocated: values are copied straight into
+ * the fixed size fields, cut short if they don't fit.
+ * A status line starts a new response (after a redirect, say) and clears
+ * everything but the location.
+ */
+void parse_header_line(const char *line, size_t length, txt_headers *hdrs);
+
+#endif
@@ -0,0 +1,27 @@
+#include "hostname.h"
+
+#include <algorithm>
+#include <cctype>
+
+
+std::string url_host(const std::string &url)
+{
+    size_t start = url.find("://");
+    start = start == std::string::npos ? 0 : start + 3;
+    size_t end = url.find_first_of("/?#", start);
+    std::string host = url.substr(start, end == std::string::npos ? std::string::npos : end - start);
+
+    size_t at = host.rfind('@');
+    if (at != std::string::npos)
+	host = host.substr(at + 1);
+
+    if (!host.empty() && host[0] == '[')
+	host = host.substr(1, host.find(']') - 1);
+    else if (host.find(':') != std::string::npos)
+	host = host.substr(0, host.find(':'));
+
+    std::transform(host.begin(), host.end(), host.begin(),
+		   [](unsigned char c) { return std::tolower(c); });
+
+    return host;
+}
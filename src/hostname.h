@@ -0,0 +1,9 @@
+#ifndef HOSTNAME_H
+#define HOSTNAME_H
+
+#include <string>
+
+/* Lowercase host name of url, without the port, user info or brackets */
+std::string url_host(const std::string &url);
+
+#endif
@@ -0,0 +1,175 @@
+#include "journal.h"
+#include "fileops.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+// First line of every journal, to tell ours apart and version the format
+#define JOURNAL_MAGIC "curler-journal 1"
+
+
+bool journal::load(const std::string &fullpath)
+{
+    std::ifstream in(fullpath + JOURNAL_SUFFIX);
+    std::string line;
+
+    if (!in.is_open() || !std::getline(in, line) || line != JOURNAL_MAGIC)
+	return false;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    url.clear();
+    etag.clear();
+    last_modified.clear();
+    length = -1;
+    ranges.clear();
+
+    while (std::getline(in, line)) {
+	size_t space = line.find(' ');
+	std::string key = line.substr(0, space);
+	std::string value = space == std::string::npos ? "" : line.substr(space + 1);
+
+	if (key == "url")
+	    url = value;
+	else if (key == "etag")
+	    etag = value;
+	else if (key == "last-modified")
+	    last_modified = value;
+	else if (key == "length")
+	    length = atoll(value.c_str());
+	else if (key == "range") {
+	    long long start, end;
+	    if (sscanf(value.c_str(), "%lld %lld", &start, &end) == 2 && 0 <= start && start < end)
+		ranges.emplace_back(start, end);
+	}
+    }
+    path = fullpath + JOURNAL_SUFFIX;
+    on_disk = true;
+
+    return !url.empty();
+}
+
+
+void journal::start(const std::string &fullpath, const std::string &url, const std::string &etag,
+		    const std::string &last_modified, long long length, long long keep_from)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::pair<long long, long long>> kept;
+
+    for (const auto &r : ranges) {
+	if (r.first < keep_from)
+	    kept.emplace_back(r.first, std::min(r.second, keep_from));
+    }
+    // A resume of a file we had no journal for
+    if (kept.empty() && keep_from > 0)
+	kept.emplace_back(0, keep_from);
+
+    this->url = url;
+    this->etag = etag;
+    this->last_modified = last_modified;
+    this->length = length;
+    ranges = kept;
+    path = fullpath + JOURNAL_SUFFIX;
+}
+
+
+bool journal::save()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (path.empty())
+	return false;
+
+    std::string tmp = path + ".tmp";
+    {
+	std::ofstream out(tmp, std::ios::trunc);
+	out << JOURNAL_MAGIC << '\n' << "url " << url << '\n';
+	if (!etag.empty())
+	    out << "etag " << etag << '\n';
+	if (!last_modified.empty())
+	    out << "last-modified " << last_modified << '\n';
+	out << "length " << length << '\n';
+	for (const auto &r : ranges)
+	    out << "range " << r.first << ' ' << r.second << '\n';
+	if (!out.good())
+	    return false;
+    }
+
+    if (rename(tmp.c_str(), path.c_str()) != 0)
+	return false;
+    if (!on_disk)
+	fileops::created(path);
+    on_disk = true;
+
+    return true;
+}
+
+
+void journal::remove()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (on_disk) {
+	::remove(path.c_str());
+	fileops::removed(path);
+    }
+    on_disk = false;
+    path.clear();
+    ranges.clear();
+}
+
+
+void journal::add_range(long long start, long long end)
+{
+    if (start >= end)
+	return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::pair<long long, long long>> merged;
+    bool placed = false;
+
+    // Ranges are sorted, so merge the new one in on the way through
+    for (const auto &r : ranges) {
+	if (r.second < start) {
+	    merged.push_back(r);
+	} else if (end < r.first) {
+	    if (!placed)
+		merged.emplace_back(start, end);
+	    placed = true;
+	    merged.push_back(r);
+	} else {
+	    start = std::min(start, r.first);
+	    end = std::max(end, r.second);
+	}
+    }
+    if (!placed)
+	merged.emplace_back(start, end);
+
+    ranges = merged;
+}
+
+
+void journal::checkpoint(long long start, long long end)
+{
+    add_range(start, end);
+    save();
+}
+
+
+long long journal::contiguous()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (ranges.empty() || ranges.front().first != 0)
+	return 0;
+
+    return ranges.front().second;
+}
+
+
+std::string journal::validator() const
+{
+    if (!etag.empty() && etag.compare(0, 2, "W/") != 0)
+	return etag;
+
+    return last_modified;
+}
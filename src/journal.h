@@ -0,0 +1,64 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * Sidecar file kept next to a partial download, named after it with
+ * JOURNAL_SUFFIX appended. It records where the file came from (url, ETag,
+ * Last-Modified and expected length) and which byte ranges of it are on
+ * disk, so an interrupted download can be resumed exactly, even when the
+ * file was preallocated or written by several segments out of order. The
+ * journal is removed once the download completes, so a file that has one
+ * is never complete.
+ *
+ * Ranges are only recorded once their writes have landed, but they aren't
+ * synced to disk, so they survive curler being killed, not the machine
+ * going down.
+ */
+#define JOURNAL_SUFFIX ".curler"
+
+class journal {
+public:
+    /* Reads the journal of the file at fullpath. Returns false if there's none */
+    bool load(const std::string &fullpath);
+    /*
+     * Starts a journal for the file at fullpath, replacing whatever was
+     * loaded. With keep_from set, ranges already recorded up to that offset
+     * are kept, since that part of the file is being resumed rather than
+     * downloaded again. Not written to disk until save().
+     */
+    void start(const std::string &fullpath, const std::string &url, const std::string &etag,
+	       const std::string &last_modified, long long length, long long keep_from = 0);
+    /* Writes the journal out, replacing the old one in one step */
+    bool save();
+    /* Deletes the journal, for when the download is complete */
+    void remove();
+    /* Whether start() or load() has been called since the last remove() */
+    bool active() const { return !path.empty(); }
+
+    /* Records that bytes [start, end) of the file are on disk */
+    void add_range(long long start, long long end);
+    /* add_range() followed by save(). Safe to call from several threads at once */
+    void checkpoint(long long start, long long end);
+    /* Bytes on disk from the start of the file, up to the first gap */
+    long long contiguous();
+    /* Value for an If-Range header: the ETag if it's a strong one, else Last-Modified */
+    std::string validator() const;
+
+    std::string url;
+    std::string etag;
+    std::string last_modified;
+    long long length = -1;  // Expected size of the whole file, -1 if unknown
+
+private:
+    std::string path;  // Of the journal itself, empty if there's none
+    bool on_disk = false;  // Loaded or saved, so remove() has a file to delete
+    std::vector<std::pair<long long, long long>> ranges;  // Sorted, merged
+    std::mutex mtx;
+};
+
+#endif
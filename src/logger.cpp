@@ -1,40 +1,316 @@
 #include "logger.h"
-#include <iostream>
+#include "progress.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>
 #include <string>
+#include <thread>
+
+// Lines the ring buffer holds. Loggers wait for room once it's full
+#define RING_SIZE 4096
+#define RING_MASK (RING_SIZE - 1)
 
-std::string err[] = {
-    "Path is not writeable",
-    "Couldn't download file",
-    "\nTried but couldn't set file modification time to remote file time",
-    "Couldn't open",
-    "URL is empty. Did you specify a valid URL?"
+/*
+ * A line on the ring buffer. seq says whose turn the slot is: it's free for
+ * the logger that claimed position pos once seq == pos, and holds that line
+ * for the writer once seq == pos + 1.
+ */
+struct slot {
+    std::atomic<size_t> seq;
+    std::string line;
 };
 
-std::string warn[] = {
-    "\nCouldn't determine file modification time",
-    "Couldn't determine filename",
-    "Couldn't determine filetype",
-    "Remote and local file modification time match, but size is different.\nRedownloading"
+static std::atomic<int> threshold(LOG_INFO);
+static std::atomic<bool> running(false);  // Whether lines go on the ring, or straight out
+
+static slot ring[RING_SIZE];
+static std::atomic<size_t> head(0);  // Next position to claim for a line
+static size_t tail = 0;              // Next position to write out, only touched by the writer
+
+static std::thread writer_thread;
+static std::mutex wake_mtx;          // Guards stopping, and the writer going to sleep
+static std::condition_variable wake_cv;
+static std::atomic<bool> sleeping(false);
+static bool stopping = false;
+
+// Keeps the writer thread and lines written right away from interleaving
+static std::mutex write_mtx;
+
+static void write_loop();
+static bool drain(std::string &batch);
+static void write_out(const std::string &text);
+static void emit(std::string &&line);
+static void append_fields(std::string &line, std::initializer_list<field> fields);
+
+const message err[] = {
+    {LOG_ERROR, "Path is not writeable"},
+    {LOG_ERROR, "Couldn't download file"},
+    {LOG_ERROR, "\nTried but couldn't set file modification time to remote file time"},
+    {LOG_ERROR, "Couldn't open"},
+    {LOG_ERROR, "URL is empty. Did you specify a valid URL?"},
+    {LOG_ERROR, "Invalid value for option"},
+    {LOG_ERROR, "Couldn't open file for writing:"},
+    {LOG_ERROR, "Couldn't write to"},
+    {LOG_ERROR, "Not enough disk space for"},
+    {LOG_ERROR, "Couldn't save the sync file"},
+    {LOG_ERROR, "Checksum still doesn't match after downloading again. Kept with .corrupt appended:"},
+    {LOG_ERROR, "Unknown or malformed checksum"},
+    {LOG_ERROR, "Request failed, giving up:"}
 };
 
-std::string info[] = {
-    "Found incomplete file at",
-    "Skipping already downloaded file:",
-    "Resuming download at byte",
-    "Downloading to",
-    "Done",
-    "DEBUG:"
+const message warn[] = {
+    {LOG_WARN, "\nCouldn't determine file modification time"},
+    {LOG_WARN, "Couldn't determine filename"},
+    {LOG_WARN, "Couldn't determine filetype"},
+    {LOG_WARN, "Remote and local file modification time match, but size is different.\nRedownloading"},
+    {LOG_WARN, "Segmented download failed. Downloading as a single stream"},
+    {LOG_WARN, "Local file is larger than the remote one.\nRedownloading"},
+    {LOG_WARN, "Couldn't preallocate disk space for"},
+    {LOG_WARN, "Remote file has changed since it was partially downloaded.\nRedownloading"},
+    {LOG_WARN, "Checksum doesn't match. Downloading again"},
+    {LOG_WARN, "Request failed:"},
+    {LOG_WARN, "libcurl was built without HTTP/2. Using HTTP/1.1"},
+    {LOG_WARN, "HTTP/2 without TLS needs libcurl 8 or later. Using HTTP/1.1 for http:// urls"}
 };
 
+const message info[] = {
+    {LOG_INFO, "Found incomplete file at"},
+    {LOG_INFO, "Skipping already downloaded file:"},
+    {LOG_INFO, "Resuming download at byte"},
+    {LOG_INFO, "Downloading to"},
+    {LOG_INFO, "Done"},
+    {LOG_INFO, "Splitting download into segments:"},
+    {LOG_INFO, "Unchanged since the last sync, skipping"},
+    {LOG_INFO, "Connection pool:"},
+    {LOG_INFO, "Host"},
+    {LOG_INFO, "Hosts not listed:"},
+    {LOG_INFO, "Write buffers:"},
+    {LOG_INFO, "Hedged requests:"},
+    {LOG_DEBUG, "DEBUG:"},
+    {LOG_DEBUG, "Request finished:"},
+    {LOG_DEBUG, "Taking over the end of a slower segment:"}
+};
 
-void log(std::string msg) {
-    std::cout << msg << std::endl;
+
+void logger::set_level(log_level level)
+{
+    threshold.store(level, std::memory_order_relaxed);
 }
 
-void log(std::string msg, std::string ext) {
-    std::cout << msg << " \"" << ext << "\"." << std::endl;
+
+bool logger::enabled(log_level level)
+{
+    return level <= threshold.load(std::memory_order_relaxed);
 }
 
-void log(std::string msg, long ext) {
-    std::cout << msg << " " << ext << "." << std::endl;
+
+void logger::init()
+{
+    for (size_t i = 0; i < RING_SIZE; i++)
+	ring[i].seq.store(i, std::memory_order_relaxed);
+    head.store(0, std::memory_order_relaxed);
+    tail = 0;
+    stopping = false;
+    sleeping.store(false, std::memory_order_relaxed);
+
+    writer_thread = std::thread(write_loop);
+    running.store(true, std::memory_order_release);
+}
+
+
+void logger::cleanup()
+{
+    if (!running.load(std::memory_order_acquire))
+	return;
+
+    running.store(false, std::memory_order_release);
+    {
+	std::lock_guard<std::mutex> lock(wake_mtx);
+	stopping = true;
+    }
+    wake_cv.notify_one();
+    writer_thread.join();
+}
+
+
+void log(const message &msg)
+{
+    if (!logger::enabled(msg.level))
+	return;
+
+    std::string line(msg.text);
+    line += '\n';
+    emit(std::move(line));
+}
+
+void log(const message &msg, const std::string &ext)
+{
+    if (!logger::enabled(msg.level))
+	return;
+
+    std::string line(msg.text);
+    line.reserve(line.length() + ext.length() + 5);
+    line += " \"";
+    line += ext;
+    line += "\".\n";
+    emit(std::move(line));
+}
+
+void log(const message &msg, long ext)
+{
+    if (!logger::enabled(msg.level))
+	return;
+
+    std::string line(msg.text);
+    line += ' ';
+    line += std::to_string(ext);
+    line += ".\n";
+    emit(std::move(line));
+}
+
+void log(const message &msg, std::initializer_list<field> fields)
+{
+    if (!logger::enabled(msg.level))
+	return;
+
+    std::string line(msg.text);
+    append_fields(line, fields);
+    line += '\n';
+    emit(std::move(line));
+}
+
+void log(const message &msg, const std::string &ext, std::initializer_list<field> fields)
+{
+    if (!logger::enabled(msg.level))
+	return;
+
+    std::string line(msg.text);
+    line += " \"";
+    line += ext;
+    line += '"';
+    append_fields(line, fields);
+    line += '\n';
+    emit(std::move(line));
+}
+
+
+/* Puts line on the ring for the writer thread, or writes it out if there's none */
+static void emit(std::string &&line)
+{
+    if (!running.load(std::memory_order_acquire)) {
+	write_out(line);
+	return;
+    }
+
+    size_t pos = head.load(std::memory_order_relaxed);
+    slot *s;
+    for (;;) {
+	s = &ring[pos & RING_MASK];
+	size_t seq = s->seq.load(std::memory_order_acquire);
+	long diff = static_cast<long>(seq - pos);
+
+	if (diff == 0) {
+	    if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+		break;
+	} else if (diff < 0) {
+	    // Full. The writer is awake, since every line on the ring woke it
+	    std::this_thread::yield();
+	    pos = head.load(std::memory_order_relaxed);
+	} else
+	    pos = head.load(std::memory_order_relaxed);
+    }
+
+    s->line = std::move(line);
+    s->seq.store(pos + 1, std::memory_order_release);
+
+    // Pairs with the fence in write_loop(): either the writer sees this line
+    // before it sleeps, or this sees it sleeping and wakes it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load(std::memory_order_relaxed) && sleeping.exchange(false)) {
+	std::lock_guard<std::mutex> lock(wake_mtx);
+	wake_cv.notify_one();
+    }
+}
+
+
+/* Writes out everything on the ring in one go, and sleeps when it's empty */
+static void write_loop()
+{
+    std::string batch;
+
+    for (;;) {
+	while (drain(batch)) {
+	    write_out(batch);
+	    batch.clear();
+	}
+
+	std::unique_lock<std::mutex> lock(wake_mtx);
+	if (stopping)
+	    break;
+
+	sleeping.store(true, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (ring[tail & RING_MASK].seq.load(std::memory_order_relaxed) == tail + 1) {
+	    sleeping.store(false, std::memory_order_relaxed);
+	    continue;
+	}
+	wake_cv.wait(lock, [] { return stopping || !sleeping.load(std::memory_order_relaxed); });
+	sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    // Lines logged right before cleanup() was called
+    if (drain(batch))
+	write_out(batch);
+}
+
+
+/* Moves the lines on the ring into batch. Returns false if there were none */
+static bool drain(std::string &batch)
+{
+    bool any = false;
+
+    for (;;) {
+	slot &s = ring[tail & RING_MASK];
+	if (s.seq.load(std::memory_order_acquire) != tail + 1)
+	    break;
+	batch += s.line;
+	s.seq.store(tail + RING_SIZE, std::memory_order_release);
+	tail++;
+	any = true;
+    }
+
+    return any;
+}
+
+
+static void write_out(const std::string &text)
+{
+    std::lock_guard<std::mutex> lock(write_mtx);
+    auto hidden = progress::hide();  // Printed where the dashboard was
+    fwrite(text.data(), 1, text.length(), stdout);
+    fflush(stdout);
+}
+
+
+/* Appends the fields as key=value, quoting values that need it */
+static void append_fields(std::string &line, std::initializer_list<field> fields)
+{
+    for (const field &f : fields) {
+	line += ' ';
+	line += f.key;
+	line += '=';
+	if (!f.value.empty() && f.value.find_first_of(" \"=") == std::string::npos) {
+	    line += f.value;
+	    continue;
+	}
+	line += '"';
+	for (char c : f.value) {
+	    if (c == '"' || c == '\\')
+		line += '\\';
+	    line += c;
+	}
+	line += '"';
+    }
 }
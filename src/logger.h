@@ -1,21 +1,81 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <initializer_list>
 #include <string>
 
+/* How much is logged, each level including the ones before it */
+enum log_level {
+    LOG_ERROR,
+    LOG_WARN,
+    LOG_INFO,   // The default
+    LOG_DEBUG
+};
+
+/* An entry of the message tables, with the level it's logged at */
+struct message {
+    log_level level;
+    const char *text;
+};
+
+/* A key/value pair logged after a message, as key=value */
+struct field {
+    field(const char *key, const std::string &value) : key(key), value(value) {}
+    field(const char *key, long long value) : key(key), value(std::to_string(value)) {}
+
+    const char *key;
+    std::string value;
+};
+
+/*
+ * Logging for the whole run. Lines are formatted by the thread that logs
+ * them and put on a lock-free ring buffer, and a background thread writes
+ * out whatever has piled up in one go, so workers never wait on stdout or
+ * on each other. Until init() and after cleanup() lines are written right
+ * away instead. Messages above the level set are dropped before anything
+ * is formatted.
+ */
+namespace logger {
+    /* Sets the level. Takes effect right away, also before init() */
+    void set_level(log_level level);
+    /* Whether messages at level are logged, to skip gathering what only they need */
+    bool enabled(log_level level);
+
+    /* Starts the writer thread */
+    void init();
+    /* Writes out every line logged so far and stops the writer thread */
+    void cleanup();
+}
+
 enum {
     FILE_ERR_PERMS,
     FILE_ERR_DOWNLOAD,
     FILE_ERR_FILETIME,
     URL_ERR_TEXTFILE,
-    URL_ERR_EMPTY
+    URL_ERR_EMPTY,
+    ARG_ERR_VALUE,
+    FILE_ERR_OPEN,
+    FILE_ERR_WRITE,
+    FILE_ERR_SPACE,
+    FILE_ERR_SYNC,
+    FILE_ERR_DIGEST,
+    ARG_ERR_DIGEST,
+    FILE_ERR_REQUEST
 };
 
 enum {
     FILE_WARN_FILETIME,
     FILE_WARN_FILENAME,
     FILE_WARN_FILETYPE,
-    FILE_WARN_FILESIZE
+    FILE_WARN_FILESIZE,
+    FILE_WARN_SEGMENTED,
+    FILE_WARN_LARGER,
+    FILE_WARN_PREALLOC,
+    FILE_WARN_CHANGED,
+    FILE_WARN_DIGEST,
+    FILE_WARN_RETRY,
+    HTTP_WARN_NO_HTTP2,
+    HTTP_WARN_CLEARTEXT
 };
 
 enum {
@@ -24,15 +84,26 @@ enum {
     FILE_INFO_RESUME,
     FILE_INFO_DOWNLOAD,
     FILE_INFO_DONE,
-    DEBUG_INFO_OUT
+    FILE_INFO_SEGMENTED,
+    FILE_INFO_UPTODATE,
+    POOL_INFO_REUSE,
+    QUEUE_INFO_HOST,
+    QUEUE_INFO_MORE,
+    WRITE_INFO_POOL,
+    HEDGE_INFO_REQUESTS,
+    DEBUG_INFO_OUT,
+    DEBUG_INFO_REQUEST,
+    DEBUG_INFO_STEAL
 };
 
-extern std::string err[];
-extern std::string warn[];
-extern std::string info[];
+extern const message err[];
+extern const message warn[];
+extern const message info[];
 
-void log(std::string msg);
-void log(std::string msg, std::string ext);
-void log(std::string msg, long ext);
+void log(const message &msg);
+void log(const message &msg, const std::string &ext);
+void log(const message &msg, long ext);
+void log(const message &msg, std::initializer_list<field> fields);
+void log(const message &msg, const std::string &ext, std::initializer_list<field> fields);
 
 #endif
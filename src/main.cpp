@@ -1,42 +1,126 @@
 #include "curler.h"
+#include "engine.h"
+#include "handlepool.h"
 #include "logger.h"
+#include "options.h"
+#include "progress.h"
+#include "queue.h"
+#include "ratelimit.h"
+#include "stats.h"
+#include "urllist.h"
+#include "validators.h"
+#include "writer.h"
 
-#include <fstream>
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <string.h>
+#include <thread>
 #include <vector>
 
-struct urldata
-{
-    std::string url;
-    std::string filename;
-    std::string path;
+// Smallest buffer downloads are collected in before they're written to disk
+#define WRITE_BUFFER_SIZE (1024 * 1024)
+// Most urls queued ahead of the downloads, the rest of the lists wait unread
+#define QUEUE_DEPTH 4096
+
+/* Where urls come from, in the order they were given: a url, or a -f list */
+struct source {
+    urldata entry;
+    std::unique_ptr<urllist> list;
 };
 
-std::vector<urldata> parse_args(int argc, char *argv[]);
+std::vector<source> parse_args(int argc, char *argv[]);
+static bool is_flag(const char *arg);
+static void check_http_version();
+static void feed(workqueue &queue, std::vector<source> &sources);
+static void run_worker(workqueue &queue, size_t id);
 
 int main(int argc, char *argv[])
 {
     if (argc > 1 && strcmp(argv[1], "-h") == 0) {
-	std::cout << "usage: " << argv[0] << " [-h] [-p <path>] [-f <file>] [-u <url> [filename]]\n" << std::endl;
+	std::cout << "usage: " << argv[0] << " [-h] [-a keep|full] [-b <bytes>] [--write-memory <size>] [-j <jobs> | -e <transfers>] [--host-connections <n>] [--http2 <streams>] [--http2-prior-knowledge] [--hedge <percent>] [-n | -s <segments>] [-q | -v] [--retry <n>] [--speed-limit <rate>] [--speed-time <seconds>] [--sync <file>] [--stats-json <file>] [--limit-rate <rate>] [--limit-host <host>=<rate>] [-p <path> [--limit-path <rate>]] [-f <file>] [-u <url> [filename]]\n" << std::endl;
 	std::cout << "arguments:\n\t-h\tShow this help message and exit\n"
+		  << "\t-j\tNumber of downloads to run in parallel (defaults to 1)\n"
+		  << "\t-a\tPreallocate disk space for files of known size. keep reserves the space, full also sets the file size\n"
+		  << "\t-b\tSize of the receive buffer for each download, in bytes (1024 to 10485760)\n"
+		  << "\t--write-memory\tMost memory to hold downloaded data in until it's written, like 512M (defaults to 256M). Downloads pause when it's used up\n"
+		  << "\t-e\tRun up to this many downloads at once on a single-threaded event loop\n"
+		  << "\t--host-connections\tMost downloads to run at once from any one host (no limit by default)\n"
+		  << "\t--http2\tAsk for HTTP/2, and run up to this many downloads over one connection at once with -e\n"
+		  << "\t--http2-prior-knowledge\tSpeak HTTP/2 right away, also to http:// urls, for servers known to support it\n"
+		  << "\t--hedge\tWith -e, send a request again on another connection when its response is slower to start than all but this percent of them, and keep whichever answers first. At most this percent of requests are sent twice\n"
+		  << "\t-n\tDon't ask for the headers before downloading. Saves a round trip per file\n"
+		  << "\t-s\tNumber of connections to split each large file over, if the server supports it\n"
+		  << "\t-q\tOnly log errors\n"
+		  << "\t-v\tAlso log every request as it finishes\n"
+		  << "\t--retry\tTimes to retry a failed request, resuming from what was written (defaults to 3)\n"
+		  << "\t--speed-limit\tDrop and retry a request that gets less than this many bytes per second for --speed-time (defaults to 1)\n"
+		  << "\t--speed-time\tSeconds a request may stay below --speed-limit (defaults to 60, 0 to wait forever)\n"
 		  << "\t-p\tPath to download into (defaults to current working directory if not specified)\n"
-		  << "\t-f\tFilename to read urls and filenames from\n"
-		  << "\t-u\tURL to download, followed by optional filename\n" << std::endl;
+		  << "\t-f\tFilename to read urls and filenames from, - for stdin\n"
+		  << "\t-u\tURL to download, followed by optional filename\n"
+		  << "\t--sync\tKeep the ETag and Last-Modified of every download in file, and only fetch files that changed since\n"
+		  << "\t--stats-json\tWrite the timings, size and outcome of every request to file, one JSON object per line\n"
+		  << "\t--limit-rate\tLimit the bandwidth of the whole run, in bytes per second. Takes K, M and G suffixes\n"
+		  << "\t--limit-host\tLimit the bandwidth used on a host, like example.com=500K\n"
+		  << "\t--limit-path\tLimit the bandwidth of the downloads into the path given before it\n" << std::endl;
 	std::cout << "example:\n\t"
 		  << argv[0] << " -p ~/Downloads -u https://example.com/file.mp4 video.mp4" << std::endl;
     } else if (argc > 1) {
-	std::vector<urldata> urls = parse_args(argc, argv);
-	bool res = false;
-
-	for (const urldata &url : urls) {
-	    if (url.url.length() > 0) {
-		res = download(url.url, url.path, url.filename);
-		if (!res) log(err[FILE_ERR_DOWNLOAD], url.filename);
-	    } else log(err[URL_ERR_EMPTY]);
+	std::vector<source> sources = parse_args(argc, argv);
+	workqueue queue(opts.transfers > 0 ? 1 : opts.jobs, QUEUE_DEPTH);
+	std::vector<std::thread> workers;
+
+	curl_global_init(CURL_GLOBAL_DEFAULT);
+	check_http_version();
+	handlepool::init(opts.transfers > 0 ? opts.transfers : opts.jobs * opts.segments,
+			 opts.transfers > 0);
+	// Writes are coalesced into buffers well above curl's receive buffer size
+	writer::init(std::max<size_t>(WRITE_BUFFER_SIZE, 16 * opts.buffer_size), opts.write_memory);
+	progress::init();
+	ratelimit::init();
+	if (!opts.sync_file.empty())
+	    validators::load(opts.sync_file);
+	if (!opts.stats_file.empty() && !stats::init(opts.stats_file)) {
+	    log(err[FILE_ERR_OPEN], opts.stats_file);
+	    exit(-1);
+	}
+
+	// Lines are written in the background from here on. Nothing after this exits early
+	logger::init();
+
+	// The lists are read as the downloads go, so the first one starts right away
+	std::thread feeder(feed, std::ref(queue), std::ref(sources));
+
+	if (opts.transfers > 0) {
+	    engine e(opts.transfers, opts.http2_streams);
+	    e.run(queue);
+	    e.report();
+	} else {
+	    // The main thread works the first lane itself
+	    for (size_t id = 1; id < opts.jobs; id++)
+		workers.emplace_back(run_worker, std::ref(queue), id);
+	    run_worker(queue, 0);
+	    for (std::thread &worker : workers)
+		worker.join();
 	}
+	feeder.join();
+
+	progress::cleanup();
+	ratelimit::cleanup();
+	stats::cleanup();
+	if (!validators::save())
+	    log(err[FILE_ERR_SYNC], opts.sync_file);
+	handlepool::report();
+	queue.report();
+	writer::report();
+	handlepool::cleanup();
+	writer::cleanup();
+	curl_global_cleanup();
 	log(info[FILE_INFO_DONE]);
+	logger::cleanup();
 
     } else {
 	std::cout << "Usage: " << argv[0] << " [-p <path>] [-u] <url> [filename]" << std::endl;
@@ -46,80 +130,346 @@ int main(int argc, char *argv[])
     return 0;
 }
 
-std::vector<urldata> parse_args(int argc, char *argv[])
+/* Queues the urls of every source in order, and closes the queue */
+static void feed(workqueue &queue, std::vector<source> &sources)
 {
-    std::vector<urldata> urls;
+    urldata data;
+
+    for (source &src : sources) {
+	if (src.list) {
+	    while (src.list->next(data))
+		queue.push(data);
+	    src.list.reset();
+	} else
+	    queue.push(std::move(src.entry));
+    }
+    queue.close();
+}
+
+/*
+ * Worker loop for the download queue. Each worker keeps its own curl handle
+ * for all the downloads it processes.
+ */
+static void run_worker(workqueue &queue, size_t id)
+{
+    CURL *curl = handlepool::acquire();
+    urldata url;
+
+    while (queue.pop(id, url)) {
+	if (url.url.length() > 0) {
+	    bool res = curl ? download(curl, url.url, *url.path, url.filename, url.checksum) : false;
+	    if (!res) log(err[FILE_ERR_DOWNLOAD], url.filename);
+	} else log(err[URL_ERR_EMPTY]);
+	queue.finished(id, url.url);
+    }
+
+    handlepool::release(curl);
+}
+
+std::vector<source> parse_args(int argc, char *argv[])
+{
+    std::vector<source> sources;
     urldata data;
     std::string path = "."; // Setting to . makes it possible to omit the -p flag
+    auto shared_path = std::make_shared<const std::string>(path);  // For the entries
+    std::string a = "-a";   // Flag for preallocation mode
+    std::string b = "-b";   // Flag for curl's receive buffer size
+    std::string e = "-e";   // Flag for number of transfers on the event engine
     std::string f = "-f";   // Flag for txt file containing urls
+    std::string j = "-j";   // Flag for number of parallel jobs
+    std::string n = "-n";   // Flag for skipping the header request
     std::string p = "-p";   // Flag for path
+    std::string q = "-q";   // Flag for only logging errors
+    std::string s = "-s";   // Flag for number of segments per file
     std::string u = "-u";   // Flag for url
+    std::string v = "-v";   // Flag for logging every request
+    std::string write_memory = "--write-memory";  // Flag for the memory limit of the write buffers
+    std::string host_connections = "--host-connections";  // Flag for the per host download limit
+    std::string http2 = "--http2";  // Flag for HTTP/2 and the streams per connection
+    std::string http2_prior_knowledge = "--http2-prior-knowledge";  // Flag for HTTP/2 without negotiating it
+    std::string hedge = "--hedge";  // Flag for the percent of requests to hedge
+    std::string retry = "--retry";  // Flag for the number of retries
+    std::string speed_limit = "--speed-limit";  // Flag for the rate a request counts as stalled below
+    std::string speed_time = "--speed-time";  // Flag for how long a request may stall
+    std::string sync = "--sync";  // Flag for the file of validators from earlier runs
+    std::string stats_json = "--stats-json";  // Flag for the per request telemetry file
+    std::string limit_rate = "--limit-rate";  // Flag for the bandwidth limit of the whole run
+    std::string limit_host = "--limit-host";  // Flag for a per host bandwidth limit
+    std::string limit_path = "--limit-path";  // Flag for the bandwidth limit of the current path
 
     for (int i=1; i < argc; i++) {
 	if (p.compare(argv[i]) == 0) {
 	    path = argv[++i];
+	    shared_path = std::make_shared<const std::string>(path);
+	    continue;
+
+	} else if (j.compare(argv[i]) == 0) {
+	    int jobs = i+1 < argc ? atoi(argv[++i]) : 0;
+	    if (jobs < 1) {
+		log(err[ARG_ERR_VALUE], j);
+		exit(-1);
+	    }
+	    opts.jobs = jobs;
+	    continue;
+
+	} else if (a.compare(argv[i]) == 0) {
+	    std::string mode = i+1 < argc ? argv[++i] : "";
+	    if (mode == "keep")
+		opts.prealloc = prealloc_mode::KEEP;
+	    else if (mode == "full")
+		opts.prealloc = prealloc_mode::FULL;
+	    else {
+		log(err[ARG_ERR_VALUE], a);
+		exit(-1);
+	    }
+	    continue;
+
+	} else if (b.compare(argv[i]) == 0) {
+	    long size = i+1 < argc ? atol(argv[++i]) : 0;
+	    if (size < 1024 || size > CURL_MAX_READ_SIZE) {
+		log(err[ARG_ERR_VALUE], b);
+		exit(-1);
+	    }
+	    opts.buffer_size = size;
+	    continue;
+
+	} else if (e.compare(argv[i]) == 0) {
+	    int transfers = i+1 < argc ? atoi(argv[++i]) : 0;
+	    if (transfers < 1) {
+		log(err[ARG_ERR_VALUE], e);
+		exit(-1);
+	    }
+	    opts.transfers = transfers;
+	    continue;
+
+	} else if (host_connections.compare(argv[i]) == 0) {
+	    int connections = i+1 < argc ? atoi(argv[++i]) : 0;
+	    if (connections < 1) {
+		log(err[ARG_ERR_VALUE], host_connections);
+		exit(-1);
+	    }
+	    opts.host_connections = connections;
+	    continue;
+
+	} else if (http2.compare(argv[i]) == 0) {
+	    long streams = i+1 < argc ? atol(argv[++i]) : 0;
+	    if (streams < 1) {
+		log(err[ARG_ERR_VALUE], http2);
+		exit(-1);
+	    }
+	    opts.http2_streams = streams;
+	    // HTTP/2 over TLS, where the server can turn it down, HTTP/1.1 for http://
+	    if (opts.http_version == CURL_HTTP_VERSION_NONE)
+		opts.http_version = CURL_HTTP_VERSION_2TLS;
+	    continue;
+
+	} else if (http2_prior_knowledge.compare(argv[i]) == 0) {
+	    opts.http_version = CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE;
+	    continue;
+
+	} else if (hedge.compare(argv[i]) == 0) {
+	    double percent = i+1 < argc ? strtod(argv[++i], nullptr) : 0;
+	    if (!(percent > 0 && percent <= 100)) {
+		log(err[ARG_ERR_VALUE], hedge);
+		exit(-1);
+	    }
+	    opts.hedge = percent;
+	    continue;
+
+	} else if (write_memory.compare(argv[i]) == 0) {
+	    long long size = i+1 < argc ? ratelimit::parse_rate(argv[++i]) : -1;
+	    if (size < 1) {
+		log(err[ARG_ERR_VALUE], write_memory);
+		exit(-1);
+	    }
+	    opts.write_memory = size;
+	    continue;
+
+	} else if (retry.compare(argv[i]) == 0) {
+	    int retries = i+1 < argc ? atoi(argv[++i]) : -1;
+	    if (retries < 0 || !isdigit(static_cast<unsigned char>(argv[i][0]))) {
+		log(err[ARG_ERR_VALUE], retry);
+		exit(-1);
+	    }
+	    opts.retries = retries;
+	    continue;
+
+	} else if (speed_limit.compare(argv[i]) == 0) {
+	    long long rate = i+1 < argc ? ratelimit::parse_rate(argv[++i]) : -1;
+	    if (rate < 1) {
+		log(err[ARG_ERR_VALUE], speed_limit);
+		exit(-1);
+	    }
+	    opts.speed_limit = rate;
+	    continue;
+
+	} else if (speed_time.compare(argv[i]) == 0) {
+	    long seconds = i+1 < argc ? atol(argv[++i]) : -1;
+	    if (seconds < 0 || !isdigit(static_cast<unsigned char>(argv[i][0]))) {
+		log(err[ARG_ERR_VALUE], speed_time);
+		exit(-1);
+	    }
+	    opts.speed_time = seconds;
+	    continue;
+
+	} else if (sync.compare(argv[i]) == 0) {
+	    std::string file = i+1 < argc ? argv[++i] : "";
+	    if (file.empty() || is_flag(file.c_str())) {
+		log(err[ARG_ERR_VALUE], sync);
+		exit(-1);
+	    }
+	    opts.sync_file = file;
+	    continue;
+
+	} else if (stats_json.compare(argv[i]) == 0) {
+	    std::string file = i+1 < argc ? argv[++i] : "";
+	    if (file.empty() || is_flag(file.c_str())) {
+		log(err[ARG_ERR_VALUE], stats_json);
+		exit(-1);
+	    }
+	    opts.stats_file = file;
+	    continue;
+
+	} else if (limit_rate.compare(argv[i]) == 0) {
+	    long long rate = i+1 < argc ? ratelimit::parse_rate(argv[++i]) : -1;
+	    if (rate < 1) {
+		log(err[ARG_ERR_VALUE], limit_rate);
+		exit(-1);
+	    }
+	    opts.limit_rate = rate;
+	    continue;
+
+	} else if (limit_host.compare(argv[i]) == 0) {
+	    // <host>=<rate>
+	    std::string limit = i+1 < argc ? argv[++i] : "";
+	    size_t eq = limit.find('=');
+	    long long rate = eq != std::string::npos ? ratelimit::parse_rate(limit.substr(eq + 1)) : -1;
+	    if (eq == 0 || rate < 1) {
+		log(err[ARG_ERR_VALUE], limit_host);
+		exit(-1);
+	    }
+	    std::string host = limit.substr(0, eq);
+	    std::transform(host.begin(), host.end(), host.begin(),
+			   [](unsigned char c) { return std::tolower(c); });
+	    opts.host_limits[host] = rate;
+	    continue;
+
+	} else if (limit_path.compare(argv[i]) == 0) {
+	    long long rate = i+1 < argc ? ratelimit::parse_rate(argv[++i]) : -1;
+	    if (rate < 1) {
+		log(err[ARG_ERR_VALUE], limit_path);
+		exit(-1);
+	    }
+	    opts.path_limits[path] = rate;
+	    continue;
+
+	} else if (n.compare(argv[i]) == 0) {
+	    opts.no_head = true;
+	    continue;
+
+	} else if (q.compare(argv[i]) == 0) {
+	    logger::set_level(LOG_ERROR);
+	    continue;
+
+	} else if (v.compare(argv[i]) == 0) {
+	    logger::set_level(LOG_DEBUG);
+	    continue;
+
+	} else if (s.compare(argv[i]) == 0) {
+	    int segments = i+1 < argc ? atoi(argv[++i]) : 0;
+	    if (segments < 1) {
+		log(err[ARG_ERR_VALUE], s);
+		exit(-1);
+	    }
+	    opts.segments = segments;
 	    continue;
 
 	// Parse the urls, and handle having no filename
 	} else if (u.compare(argv[i]) == 0) {
 	    data.url = argv[++i];
-	    data.path = path;
-	    if (i+1 < argc && u.compare(argv[i+1]) && p.compare(argv[i+1]) && f.compare(argv[i+1]))
+	    data.path = shared_path;
+	    data.checksum = "";
+	    if (i+1 < argc && !is_flag(argv[i+1]))
 		data.filename = argv[++i];
 	    else
 		data.filename = "";
 
-	// Parse url/filename from textfile
+	// Url/filename from textfile, read once the downloads start
 	} else if (f.compare(argv[i]) == 0) {
-	    std::ifstream fd;
-	    fd.open(argv[++i], std::ios::in);
-
-	    if (fd.is_open()) {
-		std::string line;
-		size_t space;
-		while (std::getline(fd, line)) {
-		    if (!(line.empty() or line.at(0) == ' ')) {
-			space = line.find(' ');
-			if (space != std::string::npos) {
-			    data.url = line.substr(0, space);
-			    data.filename = line.substr(space + 1);
-			} else {
-			    data.url = line;
-			    data.filename = "";
-			}
-			data.path = path;
-			urls.push_back(data);
-		    }
-		}
-		continue;
+	    source src;
+	    src.list = std::make_unique<urllist>();
 
-	    } else {
+	    if (i+1 >= argc || !src.list->open(argv[++i], shared_path)) {
 		log(err[URL_ERR_TEXTFILE], argv[i]);
 		exit(-1);
 	    }
+	    sources.push_back(std::move(src));
+	    continue;
 
 	// No flags passed. Try to parse following args as a url
 	} else {
 	    std::string temp_url = argv[i];
 	    std::string temp_filename;
-	    if (i+1 < argc)
+	    data.checksum = "";
+	    if (i+1 < argc && !is_flag(argv[i+1]))
 		temp_filename = argv[++i];
 
 	    if (temp_url.substr(0, 7).compare("http://") == 0
 		|| temp_url.substr(0, 8).compare("https://") == 0
 		|| temp_url.substr(0, 6).compare("ftp://") == 0) {
 		data.url = temp_url;
-		if (temp_filename.length() > 0)
-		    data.filename = temp_filename;
+		data.filename = temp_filename;
 	    } else {
 		data.url = "";
 		data.filename = "";
 	    }
-	    data.path = path;
+	    data.path = shared_path;
 	}
 
-	urls.push_back(data);
+	source src;
+	src.entry = data;
+	sources.push_back(std::move(src));
     }
 
-    return urls;
+    return sources;
+}
+
+
+/* Checks if arg is one of our flags rather than a url or filename */
+static bool is_flag(const char *arg)
+{
+    const char *flags[] = { "-a", "-b", "-e", "-f", "-j", "-n", "-p", "-q", "-s", "-u", "-v",
+			    "--host-connections", "--http2", "--http2-prior-knowledge", "--hedge",
+			    "--retry", "--speed-limit", "--speed-time", "--sync", "--stats-json",
+			    "--write-memory", "--limit-rate", "--limit-host", "--limit-path" };
+
+    for (const char *flag : flags) {
+	if (strcmp(arg, flag) == 0)
+	    return true;
+    }
+
+    return false;
+}
+
+
+/*
+ * Falls back from the HTTP version asked for to one the libcurl we run
+ * against can do. libcurl before 8 fails every request after the first on
+ * a connection that started out as HTTP/2 without TLS.
+ */
+static void check_http_version()
+{
+    curl_version_info_data *version = curl_version_info(CURLVERSION_NOW);
+
+    if (opts.http_version == CURL_HTTP_VERSION_NONE)
+	return;
+
+    if (!(version->features & CURL_VERSION_HTTP2)) {
+	log(warn[HTTP_WARN_NO_HTTP2]);
+	opts.http_version = CURL_HTTP_VERSION_NONE;
+    } else if (opts.http_version == CURL_HTTP_VERSION_2_PRIOR_KNOWLEDGE
+	       && version->version_num < 0x080000) {
+	log(warn[HTTP_WARN_CLEARTEXT]);
+	opts.http_version = CURL_HTTP_VERSION_2TLS;
+    }
 }
@@ -1,1014 +1,2159 @@
+/* Generated by tools/gen_mimetypes.py from src/mimetypes.in. Don't edit. */
 #ifndef MIMETYPES_H
 #define MIMETYPES_H
 
-#include <map>
-#include <string>
+#include <cstdint>
+#include <string_view>
 
-using MIMETYPES = std::map<const std::string, const std::string>;
+/*
+ * Mimetypes and their file extensions, as constexpr perfect hash tables.
+ * There's nothing to set up at startup, and a lookup is one hash and one
+ * string compare.
+ */
+namespace mimetypes {
+    struct entry {
+        std::string_view key;
+        std::string_view value;
+    };
 
-/* Map of mimetypes with lowercase keys */
-const MIMETYPES mimetypes = {
-    {"application/octet-stream",        ".bin"},
-    {"application/vnd.ieee.1905",        ".1905.1"},
-    {"application/x-gtar-compressed",        ".tbz"},
-    {"application/a2l",        ".a2l"},
-    {"application/aml",        ".aml"},
-    {"application/atf",        ".atf"},
-    {"application/atfx",        ".atfx"},
-    {"application/atxml",        ".atxml"},
-    {"application/cdfx+xml",        ".cdfx"},
-    {"application/cea",        ".cea"},
-    {"application/dcd",        ".dcd"},
-    {"application/dii",        ".dii"},
-    {"application/dit",        ".dit"},
-    {"application/lxf",        ".lxf"},
-    {"application/mf4",        ".mf4"},
-    {"application/odx",        ".odx"},
-    {"application/pdx",        ".pdx"},
-    {"application/andrew-inset",        ".ez"},
-    {"application/atom+xml",        ".atom"},
-    {"application/atomcat+xml",        ".atomcat"},
-    {"application/atomdeleted+xml",        ".atomdeleted"},
-    {"application/atomsvc+xml",        ".atomsvc"},
-    {"application/atsc-dwd+xml",        ".dwd"},
-    {"application/atsc-held+xml",        ".held"},
-    {"application/atsc-rsat+xml",        ".rsat"},
-    {"application/auth-policy+xml",        ".apxml"},
-    {"application/bacnet-xdd+zip",        ".xdd"},
-    {"application/calendar+xml",        ".xcs"},
-    {"application/cbor",        ".cbor"},
-    {"application/cccex",        ".c3ex"},
-    {"application/ccmp+xml",        ".ccmp"},
-    {"application/ccxml+xml",        ".ccxml"},
-    {"application/cdmi-capability",        ".cdmia"},
-    {"application/cdmi-container",        ".cdmic"},
-    {"application/cdmi-domain",        ".cdmid"},
-    {"application/cdmi-object",        ".cdmio"},
-    {"application/cdmi-queue",        ".cdmiq"},
-    {"application/cellml+xml",        ".cml"},
-    {"application/cms",        ".cmsc"},
-    {"application/cpl+xml",        ".cpl"},
-    {"application/csrattrs",        ".csrattrs"},
-    {"application/dash+xml",        ".mpd"},
-    {"application/dashdelta",        ".mpdd"},
-    {"application/davmount+xml",        ".davmount"},
-    {"application/dicom",        ".dcm"},
-    {"application/dskpp+xml",        ".xmls"},
-    {"application/dssc+der",        ".dssc"},
-    {"application/dssc+xml",        ".xdssc"},
-    {"application/dvcs",        ".dvc"},
-    {"application/ecmascript",        ".es"},
-    {"application/efi",        ".efi"},
-    {"application/emma+xml",        ".emma"},
-    {"application/emotionml+xml",        ".emotionml"},
-    {"application/epub+zip",        ".epub"},
-    {"application/exi",        ".exi"},
-    {"application/fastinfoset",        ".finf"},
-    {"application/fdt+xml",        ".fdt"},
-    {"application/font-tdpfr",        ".pfr"},
-    {"application/geo+json",        ".geojson"},
-    {"application/geopackage+sqlite3",        ".gpkg"},
-    {"application/gltf-buffer",        ".glbuf"},
-    {"application/gml+xml",        ".gml"},
-    {"application/gzip",        ".tgz"},
-    {"application/hyperstudio",        ".stk"},
-    {"application/inkml+xml",        ".inkml"},
-    {"application/ipfix",        ".ipfix"},
-    {"application/its+xml",        ".its"},
-    {"application/javascript",        ".js"},
-    {"application/jrd+json",        ".jrd"},
-    {"application/json",        ".json"},
-    {"application/json-patch+json",        ".json-patch"},
-    {"application/ld+json",        ".jsonld"},
-    {"application/lgr+xml",        ".lgr"},
-    {"application/link-format",        ".wlnk"},
-    {"application/lost+xml",        ".lostxml"},
-    {"application/lostsync+xml",        ".lostsyncxml"},
-    {"application/lpf+zip",        ".lpf"},
-    {"application/mac-binhex40",        ".hqx"},
-    {"application/mac-compactpro",        ".cpt"},
-    {"application/mads+xml",        ".mads"},
-    {"application/marc",        ".mrc"},
-    {"application/marcxml+xml",        ".mrcx"},
-    {"application/mathematica",        ".nb"},
-    {"application/mathml+xml",        ".mml"},
-    {"application/mbox",        ".mbox"},
-    {"application/metalink+xml",        ".metalink"},
-    {"application/metalink4+xml",        ".meta4"},
-    {"application/mets+xml",        ".mets"},
-    {"application/mmt-aei+xml",        ".maei"},
-    {"application/mmt-usd+xml",        ".musd"},
-    {"application/mods+xml",        ".mods"},
-    {"application/mp21",        ".mp21"},
-    {"application/msword",        ".doc"},
-    {"application/mxf",        ".mxf"},
-    {"application/n-quads",        ".nq"},
-    {"application/n-triples",        ".nt"},
-    {"application/ocsp-request",        ".orq"},
-    {"application/ocsp-response",        ".ors"},
-    {"application/octet-stream",        ".so"},
-    {"application/oda",        ".oda"},
-    {"application/oebps-package+xml",        ".opf"},
-    {"application/ogg",        ".ogx"},
-    {"application/owl+xml",        ".owx"},
-    {"application/oxps",        ".oxps"},
-    {"application/p2p-overlay+xml",        ".relo"},
-    {"application/pdf",        ".pdf"},
-    {"application/pem-certificate-chain",        ".pem"},
-    {"application/pgp-encrypted",        ".pgp"},
-    {"application/pgp-signature",        ".sig"},
-    {"application/pkcs10",        ".p10"},
-    {"application/pkcs12",        ".pfx"},
-    {"application/pkcs7-mime",        ".p7m"},
-    {"application/pkcs7-signature",        ".p7s"},
-    {"application/pkcs8",        ".p8"},
-    {"application/pkcs8-encrypted",        ".p8e"},
-    {"application/pkix-cert",        ".cer"},
-    {"application/pkix-crl",        ".crl"},
-    {"application/pkix-pkipath",        ".pkipath"},
-    {"application/pkixcmp",        ".pki"},
-    {"application/pls+xml",        ".pls"},
-    {"application/postscript",        ".ps"},
-    {"application/provenance+xml",        ".provx"},
-    {"application/prs.cww",        ".cww"},
-    {"application/prs.hpub+zip",        ".hpub"},
-    {"application/prs.nprend",        ".rnd"},
-    {"application/prs.rdf-xml-crypt",        ".rdf-crypt"},
-    {"application/prs.xsf+xml",        ".xsf"},
-    {"application/pskc+xml",        ".pskcxml"},
-    {"application/rdf+xml",        ".rdf"},
-    {"application/reginfo+xml",        ".rif"},
-    {"application/relax-ng-compact-syntax",        ".rnc"},
-    {"application/resource-lists+xml",        ".rl"},
-    {"application/resource-lists-diff+xml",        ".rld"},
-    {"application/rfc+xml",        ".rfcxml"},
-    {"application/rls-services+xml",        ".rs"},
-    {"application/route-apd+xml",        ".rapd"},
-    {"application/route-s-tsid+xml",        ".sls"},
-    {"application/route-usd+xml",        ".rusd"},
-    {"application/rpki-ghostbusters",        ".gbr"},
-    {"application/rpki-manifest",        ".mft"},
-    {"application/rpki-roa",        ".roa"},
-    {"application/rss+xml",        ".rss"},
-    {"application/rtf",        ".rtf"},
-    {"application/scim+json",        ".scim"},
-    {"application/scvp-cv-request",        ".scq"},
-    {"application/scvp-cv-response",        ".scs"},
-    {"application/scvp-vp-request",        ".spq"},
-    {"application/scvp-vp-response",        ".spp"},
-    {"application/sdp",        ".sdp"},
-    {"application/senml+cbor",        ".senmlc"},
-    {"application/senml+json",        ".senml"},
-    {"application/senml+xml",        ".senmlx"},
-    {"application/senml-etch+cbor",        ".senml-etchc"},
-    {"application/senml-etch+json",        ".senml-etchj"},
-    {"application/senml-exi",        ".senmle"},
-    {"application/sensml+cbor",        ".sensmlc"},
-    {"application/sensml+json",        ".sensml"},
-    {"application/sensml+xml",        ".sensmlx"},
-    {"application/sensml-exi",        ".sensmle"},
-    {"application/sgml-open-catalog",        ".soc"},
-    {"application/shf+xml",        ".shf"},
-    {"application/sieve",        ".siv"},
-    {"application/simple-filter+xml",        ".cl"},
-    {"application/smil+xml",        ".sml"},
-    {"application/sparql-query",        ".rq"},
-    {"application/sparql-results+xml",        ".srx"},
-    {"application/sql",        ".sql"},
-    {"application/srgs",        ".gram"},
-    {"application/srgs+xml",        ".grxml"},
-    {"application/sru+xml",        ".sru"},
-    {"application/ssml+xml",        ".ssml"},
-    {"application/stix+json",        ".stix"},
-    {"application/swid+xml",        ".swidtag"},
-    {"application/tamp-apex-update",        ".tau"},
-    {"application/tamp-apex-update-confirm",        ".auc"},
-    {"application/tamp-community-update",        ".tcu"},
-    {"application/tamp-community-update-confirm",        ".cuc"},
-    {"application/tamp-error",        ".ter"},
-    {"application/tamp-sequence-adjust",        ".tsa"},
-    {"application/tamp-sequence-adjust-confirm",        ".sac"},
-    {"application/tamp-update",        ".tur"},
-    {"application/tamp-update-confirm",        ".tuc"},
-    {"application/td+json",        ".jsontd"},
-    {"application/tei+xml",        ".teicorpus"},
-    {"application/thraud+xml",        ".tfi"},
-    {"application/timestamp-query",        ".tsq"},
-    {"application/timestamp-reply",        ".tsr"},
-    {"application/timestamped-data",        ".tsd"},
-    {"application/trig",        ".trig"},
-    {"application/ttml+xml",        ".ttml"},
-    {"application/urc-grpsheet+xml",        ".gsheet"},
-    {"application/urc-ressheet+xml",        ".rsheet"},
-    {"application/urc-targetdesc+xml",        ".td"},
-    {"application/urc-uisocketdesc+xml",        ".uis"},
-    {"application/voicexml+xml",        ".vxml"},
-    {"application/voucher-cms+json",        ".vcj"},
-    {"application/wasm",        ".wasm"},
-    {"application/watcherinfo+xml",        ".wif"},
-    {"application/widget",        ".wgt"},
-    {"application/wsdl+xml",        ".wsdl"},
-    {"application/wspolicy+xml",        ".wspolicy"},
-    {"application/xcap-att+xml",        ".xav"},
-    {"application/xcap-caps+xml",        ".xca"},
-    {"application/xcap-diff+xml",        ".xdf"},
-    {"application/xcap-el+xml",        ".xel"},
-    {"application/xcap-error+xml",        ".xer"},
-    {"application/xcap-ns+xml",        ".xns"},
-    {"application/xhtml+xml",        ".xhtml"},
-    {"application/xliff+xml",        ".xlf"},
-    {"application/xml-dtd",        ".dtd"},
-    {"application/xop+xml",        ".xop"},
-    {"application/xslt+xml",        ".xslt"},
-    {"application/xv+xml",        ".xvml"},
-    {"application/yang",        ".yang"},
-    {"application/yin+xml",        ".yin"},
-    {"application/zip",        ".zip"},
-    {"application/zstd",        ".zst"},
-    {"application/vnd.1000minds.decision-model+xml",        ".1km"},
-    {"application/vnd.3m.post-it-notes",        ".pwn"},
-    {"application/vnd.3gpp.pic-bw-large",        ".plb"},
-    {"application/vnd.3gpp.pic-bw-small",        ".psb"},
-    {"application/vnd.3gpp.pic-bw-var",        ".pvb"},
-    {"application/vnd.3gpp2.sms",        ".sms"},
-    {"application/vnd.3gpp2.tcap",        ".tcap"},
-    {"application/vnd.3lightssoftware.imagescal",        ".imgcal"},
-    {"application/vnd.flographit",        ".gph"},
-    {"application/vnd.handheld-entertainment+xml",        ".zmm"},
-    {"application/vnd.kinar",        ".sdf"},
-    {"application/vnd.mfer",        ".mwf"},
-    {"application/vnd.mobius.daf",        ".daf"},
-    {"application/vnd.mobius.dis",        ".dis"},
-    {"application/vnd.mobius.mbk",        ".mbk"},
-    {"application/vnd.mobius.mqy",        ".mqy"},
-    {"application/vnd.mobius.msl",        ".msl"},
-    {"application/vnd.mobius.plc",        ".plc"},
-    {"application/vnd.mobius.txf",        ".txf"},
-    {"application/vnd.quark.quarkxpress",        ".qxt"},
-    {"application/vnd.simtech-mindmapper",        ".twds"},
-    {"application/vnd.accpac.simply.aso",        ".aso"},
-    {"application/vnd.accpac.simply.imp",        ".imp"},
-    {"application/vnd.acucobol",        ".acu"},
-    {"application/vnd.acucorp",        ".atc"},
-    {"application/vnd.adobe.flash.movie",        ".swf"},
-    {"application/vnd.adobe.formscentral.fcdt",        ".fcdt"},
-    {"application/vnd.adobe.fxp",        ".fxpl"},
-    {"application/vnd.adobe.xdp+xml",        ".xdp"},
-    {"application/vnd.adobe.xfdf",        ".xfdf"},
-    {"application/vnd.afpc.modca",        ".pseg3820"},
-    {"application/vnd.afpc.modca-overlay",        ".ovl"},
-    {"application/vnd.afpc.modca-pagesegment",        ".psg"},
-    {"application/vnd.ahead.space",        ".ahead"},
-    {"application/vnd.airzip.filesecure.azf",        ".azf"},
-    {"application/vnd.airzip.filesecure.azs",        ".azs"},
-    {"application/vnd.amazon.mobi8-ebook",        ".azw3"},
-    {"application/vnd.americandynamics.acc",        ".acc"},
-    {"application/vnd.amiga.ami",        ".ami"},
-    {"application/vnd.android.ota",        ".ota"},
-    {"application/vnd.android.package-archive",        ".apk"},
-    {"application/vnd.anki",        ".apkg"},
-    {"application/vnd.anser-web-certificate-issue-initiation",        ".cii"},
-    {"application/vnd.anser-web-funds-transfer-initiation",        ".fti"},
-    {"application/vnd.apple.installer+xml",        ".pkg"},
-    {"application/vnd.apple.keynote",        ".keynote"},
-    {"application/vnd.apple.mpegurl",        ".m3u8"},
-    {"application/vnd.apple.numbers",        ".numbers"},
-    {"application/vnd.apple.pages",        ".pages"},
-    {"application/vnd.aristanetworks.swi",        ".swi"},
-    {"application/vnd.artisan+json",        ".artisan"},
-    {"application/vnd.astraea-software.iota",        ".iota"},
-    {"application/vnd.audiograph",        ".aep"},
-    {"application/vnd.autopackage",        ".package"},
-    {"application/vnd.balsamiq.bmml+xml",        ".bmml"},
-    {"application/vnd.balsamiq.bmpr",        ".bmpr"},
-    {"application/vnd.banana-accounting",        ".ac2"},
-    {"application/vnd.blueice.multipass",        ".mpm"},
-    {"application/vnd.bluetooth.ep.oob",        ".ep"},
-    {"application/vnd.bluetooth.le.oob",        ".le"},
-    {"application/vnd.bmi",        ".bmi"},
-    {"application/vnd.businessobjects",        ".rep"},
-    {"application/vnd.cendio.thinlinc.clientconf",        ".tlclient"},
-    {"application/vnd.chemdraw+xml",        ".cdxml"},
-    {"application/vnd.chess-pgn",        ".pgn"},
-    {"application/vnd.chipnuts.karaoke-mmd",        ".mmd"},
-    {"application/vnd.cinderella",        ".cdy"},
-    {"application/vnd.citationstyles.style+xml",        ".csl"},
-    {"application/vnd.claymore",        ".cla"},
-    {"application/vnd.cloanto.rp9",        ".rp9"},
-    {"application/vnd.clonk.c4group",        ".c4u"},
-    {"application/vnd.cluetrust.cartomobile-config",        ".c11amc"},
-    {"application/vnd.cluetrust.cartomobile-config-pkg",        ".c11amz"},
-    {"application/vnd.coffeescript",        ".coffee"},
-    {"application/vnd.collabio.xodocuments.document",        ".xodt"},
-    {"application/vnd.collabio.xodocuments.document-template",        ".xott"},
-    {"application/vnd.collabio.xodocuments.presentation",        ".xodp"},
-    {"application/vnd.collabio.xodocuments.presentation-template",        ".xotp"},
-    {"application/vnd.collabio.xodocuments.spreadsheet",        ".xods"},
-    {"application/vnd.collabio.xodocuments.spreadsheet-template",        ".xots"},
-    {"application/vnd.comicbook+zip",        ".cbz"},
-    {"application/vnd.comicbook-rar",        ".cbr"},
-    {"application/vnd.commerce-battelle",        ".icf"},
-    {"application/vnd.commonspace",        ".cst"},
-    {"application/vnd.contact.cmsg",        ".cdbcmsg"},
-    {"application/vnd.coreos.ignition+json",        ".ignition"},
-    {"application/vnd.cosmocaller",        ".cmc"},
-    {"application/vnd.crick.clicker",        ".clkx"},
-    {"application/vnd.crick.clicker.keyboard",        ".clkk"},
-    {"application/vnd.crick.clicker.palette",        ".clkp"},
-    {"application/vnd.crick.clicker.template",        ".clkt"},
-    {"application/vnd.crick.clicker.wordbank",        ".clkw"},
-    {"application/vnd.criticaltools.wbs+xml",        ".wbs"},
-    {"application/vnd.crypto-shade-file",        ".ssvc"},
-    {"application/vnd.ctc-posml",        ".pml"},
-    {"application/vnd.cups-ppd",        ".ppd"},
-    {"application/vnd.curl",        ".curl"},
-    {"application/vnd.dart",        ".dart"},
-    {"application/vnd.data-vision.rdz",        ".rdz"},
-    {"application/vnd.dbf",        ".dbf"},
-    {"application/vnd.debian.binary-package",        ".udeb"},
-    {"application/vnd.dece.data",        ".uvvf"},
-    {"application/vnd.dece.ttml+xml",        ".uvvt"},
-    {"application/vnd.dece.unspecified",        ".uvx"},
-    {"application/vnd.dece.zip",        ".uvz"},
-    {"application/vnd.desmume.movie",        ".dsm"},
-    {"application/vnd.dna",        ".dna"},
-    {"application/vnd.document+json",        ".docjson"},
-    {"application/vnd.doremir.scorecloud-binary-document",        ".scld"},
-    {"application/vnd.dpgraph",        ".mwc"},
-    {"application/vnd.dreamfactory",        ".dfac"},
-    {"application/vnd.dtg.local.flash",        ".fla"},
-    {"application/vnd.dvb.ait",        ".ait"},
-    {"application/vnd.dvb.service",        ".svc"},
-    {"application/vnd.dynageo",        ".geo"},
-    {"application/vnd.dzr",        ".dzr"},
-    {"application/vnd.ecowin.chart",        ".mag"},
-    {"application/vnd.enliven",        ".nml"},
-    {"application/vnd.epson.esf",        ".esf"},
-    {"application/vnd.epson.msf",        ".msf"},
-    {"application/vnd.epson.quickanime",        ".qam"},
-    {"application/vnd.epson.salt",        ".slt"},
-    {"application/vnd.epson.ssf",        ".ssf"},
-    {"application/vnd.ericsson.quickcall",        ".qcall"},
-    {"application/vnd.espass-espass+zip",        ".espass"},
-    {"application/vnd.eszigno3+xml",        ".et3"},
-    {"application/vnd.etsi.asic-e+zip",        ".sce"},
-    {"application/vnd.etsi.asic-s+zip",        ".asics"},
-    {"application/vnd.etsi.timestamp-token",        ".tst"},
-    {"application/vnd.evolv.ecig.profile",        ".ecigprofile"},
-    {"application/vnd.evolv.ecig.settings",        ".ecig"},
-    {"application/vnd.evolv.ecig.theme",        ".ecigtheme"},
-    {"application/vnd.exstream-empower+zip",        ".mpw"},
-    {"application/vnd.exstream-package",        ".pub"},
-    {"application/vnd.ezpix-album",        ".ez2"},
-    {"application/vnd.ezpix-package",        ".ez3"},
-    {"application/vnd.fastcopy-disk-image",        ".dim"},
-    {"application/vnd.fdf",        ".fdf"},
-    {"application/vnd.fdsn.mseed",        ".mseed"},
-    {"application/vnd.fdsn.seed",        ".seed"},
-    {"application/vnd.ficlab.flb+zip",        ".flb"},
-    {"application/vnd.filmit.zfc",        ".zfc"},
-    {"application/vnd.fluxtime.clip",        ".ftc"},
-    {"application/vnd.font-fontforge-sfd",        ".sfd"},
-    {"application/vnd.framemaker",        ".fm"},
-    {"application/vnd.frogans.fnc",        ".fnc"},
-    {"application/vnd.frogans.ltf",        ".ltf"},
-    {"application/vnd.fsc.weblaunch",        ".fsc"},
-    {"application/vnd.fujitsu.oasys",        ".oas"},
-    {"application/vnd.fujitsu.oasys2",        ".oa2"},
-    {"application/vnd.fujitsu.oasys3",        ".oa3"},
-    {"application/vnd.fujitsu.oasysgp",        ".fg5"},
-    {"application/vnd.fujitsu.oasysprs",        ".bh2"},
-    {"application/vnd.fujixerox.ddd",        ".ddd"},
-    {"application/vnd.fujixerox.docuworks",        ".xdw"},
-    {"application/vnd.fujixerox.docuworks.binder",        ".xbd"},
-    {"application/vnd.fujixerox.docuworks.container",        ".xct"},
-    {"application/vnd.fuzzysheet",        ".fzs"},
-    {"application/vnd.genomatix.tuxedo",        ".txd"},
-    {"application/vnd.geogebra.file",        ".ggb"},
-    {"application/vnd.geogebra.tool",        ".ggt"},
-    {"application/vnd.geometry-explorer",        ".gre"},
-    {"application/vnd.geonext",        ".gxt"},
-    {"application/vnd.geoplan",        ".g2w"},
-    {"application/vnd.geospace",        ".g3w"},
-    {"application/vnd.gmx",        ".gmx"},
-    {"application/vnd.google-earth.kml+xml",        ".kml"},
-    {"application/vnd.google-earth.kmz",        ".kmz"},
-    {"application/vnd.grafeq",        ".gqs"},
-    {"application/vnd.groove-account",        ".gac"},
-    {"application/vnd.groove-help",        ".ghf"},
-    {"application/vnd.groove-identity-message",        ".gim"},
-    {"application/vnd.groove-injector",        ".grv"},
-    {"application/vnd.groove-tool-message",        ".gtm"},
-    {"application/vnd.groove-tool-template",        ".tpl"},
-    {"application/vnd.groove-vcard",        ".vcg"},
-    {"application/vnd.hal+xml",        ".hal"},
-    {"application/vnd.hbci",        ".upa"},
-    {"application/vnd.hdt",        ".hdt"},
-    {"application/vnd.hhe.lesson-player",        ".les"},
-    {"application/vnd.hp-hpgl",        ".hpgl"},
-    {"application/vnd.hp-pcl",        ".pcl"},
-    {"application/vnd.hp-hpid",        ".hpid"},
-    {"application/vnd.hp-hps",        ".hps"},
-    {"application/vnd.hp-jlyt",        ".jlt"},
-    {"application/vnd.hydrostatix.sof-data",        ".sfd-hdstx"},
-    {"application/vnd.hzn-3d-crossword",        ".x3d"},
-    {"application/vnd.ibm.minipay",        ".mpy"},
-    {"application/vnd.ibm.electronic-media",        ".emm"},
-    {"application/vnd.ibm.rights-management",        ".irm"},
-    {"application/vnd.ibm.secure-container",        ".sc"},
-    {"application/vnd.iccprofile",        ".icm"},
-    {"application/vnd.igloader",        ".igl"},
-    {"application/vnd.imagemeter.folder+zip",        ".imf"},
-    {"application/vnd.imagemeter.image+zip",        ".imi"},
-    {"application/vnd.immervision-ivp",        ".ivp"},
-    {"application/vnd.immervision-ivu",        ".ivu"},
-    {"application/vnd.ims.imsccv1p1",        ".imscc"},
-    {"application/vnd.insors.igm",        ".igm"},
-    {"application/vnd.intercon.formnet",        ".xpx"},
-    {"application/vnd.intergeo",        ".i2g"},
-    {"application/vnd.intu.qbo",        ".qbo"},
-    {"application/vnd.intu.qfx",        ".qfx"},
-    {"application/vnd.ipunplugged.rcprofile",        ".rcprofile"},
-    {"application/vnd.irepository.package+xml",        ".irp"},
-    {"application/vnd.is-xpr",        ".xpr"},
-    {"application/vnd.isac.fcs",        ".fcs"},
-    {"application/vnd.jam",        ".jam"},
-    {"application/vnd.jcp.javame.midlet-rms",        ".rms"},
-    {"application/vnd.jisp",        ".jisp"},
-    {"application/vnd.joost.joda-archive",        ".joda"},
-    {"application/vnd.kahootz",        ".ktz"},
-    {"application/vnd.kde.karbon",        ".karbon"},
-    {"application/vnd.kde.kchart",        ".chrt"},
-    {"application/vnd.kde.kformula",        ".kfo"},
-    {"application/vnd.kde.kivio",        ".flw"},
-    {"application/vnd.kde.kontour",        ".kon"},
-    {"application/vnd.kde.kpresenter",        ".kpt"},
-    {"application/vnd.kde.kspread",        ".ksp"},
-    {"application/vnd.kde.kword",        ".kwt"},
-    {"application/vnd.kenameaapp",        ".htke"},
-    {"application/vnd.kidspiration",        ".kia"},
-    {"application/vnd.koan",        ".skt"},
-    {"application/vnd.kodak-descriptor",        ".sse"},
-    {"application/vnd.las.las+json",        ".lasjson"},
-    {"application/vnd.las.las+xml",        ".lasxml"},
-    {"application/vnd.llamagraphics.life-balance.desktop",        ".lbd"},
-    {"application/vnd.llamagraphics.life-balance.exchange+xml",        ".lbe"},
-    {"application/vnd.logipipe.circuit+zip",        ".lcs"},
-    {"application/vnd.loom",        ".loom"},
-    {"application/vnd.lotus-1-2-3",        ".wk4"},
-    {"application/vnd.lotus-approach",        ".vew"},
-    {"application/vnd.lotus-freelance",        ".prz"},
-    {"application/vnd.lotus-notes",        ".ntf"},
-    {"application/vnd.lotus-organizer",        ".org"},
-    {"application/vnd.lotus-screencam",        ".scm"},
-    {"application/vnd.lotus-wordpro",        ".sam"},
-    {"application/vnd.macports.portpkg",        ".portpkg"},
-    {"application/vnd.mapbox-vector-tile",        ".mvt"},
-    {"application/vnd.marlin.drm.mdcf",        ".mdc"},
-    {"application/vnd.maxmind.maxmind-db",        ".mmdb"},
-    {"application/vnd.mcd",        ".mcd"},
-    {"application/vnd.medcalcdata",        ".mc1"},
-    {"application/vnd.mediastation.cdkey",        ".cdkey"},
-    {"application/vnd.mfmp",        ".mfm"},
-    {"application/vnd.micrografx.flo",        ".flo"},
-    {"application/vnd.micrografx.igx",        ".igx"},
-    {"application/vnd.mif",        ".mif"},
-    {"application/vnd.mophun.application",        ".mpn"},
-    {"application/vnd.mophun.certificate",        ".mpc"},
-    {"application/vnd.mozilla.xul+xml",        ".xul"},
-    {"application/vnd.ms-3mfdocument",        ".3mf"},
-    {"application/vnd.ms-artgalry",        ".cil"},
-    {"application/vnd.ms-asf",        ".asf"},
-    {"application/vnd.ms-cab-compressed",        ".cab"},
-    {"application/vnd.ms-excel",        ".xlw"},
-    {"application/vnd.ms-excel.addin.macroenabled.12",        ".xlam"},
-    {"application/vnd.ms-excel.sheet.binary.macroenabled.12",        ".xlsb"},
-    {"application/vnd.ms-excel.sheet.macroenabled.12",        ".xlsm"},
-    {"application/vnd.ms-excel.template.macroenabled.12",        ".xltm"},
-    {"application/vnd.ms-fontobject",        ".eot"},
-    {"application/vnd.ms-htmlhelp",        ".chm"},
-    {"application/vnd.ms-ims",        ".ims"},
-    {"application/vnd.ms-lrm",        ".lrm"},
-    {"application/vnd.ms-officetheme",        ".thmx"},
-    {"application/vnd.ms-powerpoint",        ".ppt"},
-    {"application/vnd.ms-powerpoint.addin.macroenabled.12",        ".ppam"},
-    {"application/vnd.ms-powerpoint.presentation.macroenabled.12",        ".pptm"},
-    {"application/vnd.ms-powerpoint.slide.macroenabled.12",        ".sldm"},
-    {"application/vnd.ms-powerpoint.slideshow.macroenabled.12",        ".ppsm"},
-    {"application/vnd.ms-powerpoint.template.macroenabled.12",        ".potm"},
-    {"application/vnd.ms-project",        ".mpt"},
-    {"application/vnd.ms-tnef",        ".tnf"},
-    {"application/vnd.ms-word.document.macroenabled.12",        ".docm"},
-    {"application/vnd.ms-word.template.macroenabled.12",        ".dotm"},
-    {"application/vnd.ms-works",        ".wps"},
-    {"application/vnd.ms-wpl",        ".wpl"},
-    {"application/vnd.ms-xpsdocument",        ".xps"},
-    {"application/vnd.msa-disk-image",        ".msa"},
-    {"application/vnd.mseq",        ".mseq"},
-    {"application/vnd.multiad.creator",        ".crtr"},
-    {"application/vnd.multiad.creator.cif",        ".cif"},
-    {"application/vnd.musician",        ".mus"},
-    {"application/vnd.muvee.style",        ".msty"},
-    {"application/vnd.mynfc",        ".taglet"},
-    {"application/vnd.nervana",        ".request"},
-    {"application/vnd.neurolanguage.nlu",        ".nlu"},
-    {"application/vnd.nimn",        ".nimn"},
-    {"application/vnd.nintendo.nitro.rom",        ".nds"},
-    {"application/vnd.nintendo.snes.rom",        ".smc"},
-    {"application/vnd.nitf",        ".nitf"},
-    {"application/vnd.noblenet-directory",        ".nnd"},
-    {"application/vnd.noblenet-sealer",        ".nns"},
-    {"application/vnd.noblenet-web",        ".nnw"},
-    {"application/vnd.nokia.n-gage.ac+xml",        ".ac"},
-    {"application/vnd.nokia.n-gage.data",        ".ngdat"},
-    {"application/vnd.nokia.n-gage.symbian.install",        ".n-gage"},
-    {"application/vnd.nokia.radio-preset",        ".rpst"},
-    {"application/vnd.nokia.radio-presets",        ".rpss"},
-    {"application/vnd.novadigm.edm",        ".edm"},
-    {"application/vnd.novadigm.edx",        ".edx"},
-    {"application/vnd.novadigm.ext",        ".ext"},
-    {"application/vnd.oasis.opendocument.chart",        ".odc"},
-    {"application/vnd.oasis.opendocument.chart-template",        ".otc"},
-    {"application/vnd.oasis.opendocument.database",        ".odb"},
-    {"application/vnd.oasis.opendocument.formula",        ".odf"},
-    {"application/vnd.oasis.opendocument.graphics",        ".odg"},
-    {"application/vnd.oasis.opendocument.graphics-template",        ".otg"},
-    {"application/vnd.oasis.opendocument.image",        ".odi"},
-    {"application/vnd.oasis.opendocument.image-template",        ".oti"},
-    {"application/vnd.oasis.opendocument.presentation",        ".odp"},
-    {"application/vnd.oasis.opendocument.presentation-template",        ".otp"},
-    {"application/vnd.oasis.opendocument.spreadsheet",        ".ods"},
-    {"application/vnd.oasis.opendocument.spreadsheet-template",        ".ots"},
-    {"application/vnd.oasis.opendocument.text",        ".odt"},
-    {"application/vnd.oasis.opendocument.text-master",        ".odm"},
-    {"application/vnd.oasis.opendocument.text-template",        ".ott"},
-    {"application/vnd.oasis.opendocument.text-web",        ".oth"},
-    {"application/vnd.olpc-sugar",        ".xo"},
-    {"application/vnd.oma.dd+xml",        ".dd"},
-    {"application/vnd.oma.dd2+xml",        ".dd2"},
-    {"application/vnd.oma.drm.content",        ".dcf"},
-    {"application/vnd.oma.drm.dcf",        ".o4v"},
-    {"application/vnd.oma.drm.message",        ".dm"},
-    {"application/vnd.oma.drm.rights+wbxml",        ".drc"},
-    {"application/vnd.oma.drm.rights+xml",        ".dr"},
-    {"application/vnd.onepager",        ".tam"},
-    {"application/vnd.onepagertamp",        ".tamp"},
-    {"application/vnd.onepagertamx",        ".tamx"},
-    {"application/vnd.onepagertat",        ".tat"},
-    {"application/vnd.onepagertatp",        ".tatp"},
-    {"application/vnd.onepagertatx",        ".tatx"},
-    {"application/vnd.openblox.game+xml",        ".obgx"},
-    {"application/vnd.openblox.game-binary",        ".obg"},
-    {"application/vnd.openeye.oeb",        ".oeb"},
-    {"application/vnd.openofficeorg.extension",        ".oxt"},
-    {"application/vnd.openstreetmap.data+xml",        ".osm"},
-    {"application/vnd.openxmlformats-officedocument.presentationml.presentation",        ".pptx"},
-    {"application/vnd.openxmlformats-officedocument.presentationml.slide",        ".sldx"},
-    {"application/vnd.openxmlformats-officedocument.presentationml.slideshow",        ".ppsx"},
-    {"application/vnd.openxmlformats-officedocument.presentationml.template",        ".potx"},
-    {"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",        ".xlsx"},
-    {"application/vnd.openxmlformats-officedocument.spreadsheetml.template",        ".xltx"},
-    {"application/vnd.openxmlformats-officedocument.wordprocessingml.document",        ".docx"},
-    {"application/vnd.openxmlformats-officedocument.wordprocessingml.template",        ".dotx"},
-    {"application/vnd.osa.netdeploy",        ".ndc"},
-    {"application/vnd.osgeo.mapguide.package",        ".mgp"},
-    {"application/vnd.osgi.dp",        ".dp"},
-    {"application/vnd.osgi.subsystem",        ".esa"},
-    {"application/vnd.oxli.countgraph",        ".oxlicg"},
-    {"application/vnd.palm",        ".prc"},
-    {"application/vnd.panoply",        ".plp"},
-    {"application/vnd.patentdive",        ".dive"},
-    {"application/vnd.pawaafile",        ".paw"},
-    {"application/vnd.pg.format",        ".str"},
-    {"application/vnd.pg.osasli",        ".ei6"},
-    {"application/vnd.piaccess.application-license",        ".pil"},
-    {"application/vnd.picsel",        ".efif"},
-    {"application/vnd.pmi.widget",        ".wg"},
-    {"application/vnd.pocketlearn",        ".plf"},
-    {"application/vnd.powerbuilder6",        ".pbd"},
-    {"application/vnd.preminet",        ".preminet"},
-    {"application/vnd.previewsystems.box",        ".vbox"},
-    {"application/vnd.proteus.magazine",        ".mgz"},
-    {"application/vnd.psfs",        ".psfs"},
-    {"application/vnd.publishare-delta-tree",        ".qps"},
-    {"application/vnd.pvi.ptid1",        ".ptid"},
-    {"application/vnd.qualcomm.brew-app-res",        ".bar"},
-    {"application/vnd.quobject-quoxdocument",        ".quox"},
-    {"application/vnd.rainstor.data",        ".tree"},
-    {"application/vnd.rar",        ".rar"},
-    {"application/vnd.realvnc.bed",        ".bed"},
-    {"application/vnd.recordare.musicxml",        ".mxl"},
-    {"application/vnd.rig.cryptonote",        ".cryptonote"},
-    {"application/vnd.route66.link66+xml",        ".link66"},
-    {"application/vnd.sailingtracker.track",        ".st"},
-    {"application/vnd.sar",        ".SAR"},
-    {"application/vnd.scribus",        ".slaz"},
-    {"application/vnd.sealed.3df",        ".s3df"},
-    {"application/vnd.sealed.csf",        ".scsf"},
-    {"application/vnd.sealed.doc",        ".sdoc"},
-    {"application/vnd.sealed.eml",        ".seml"},
-    {"application/vnd.sealed.mht",        ".smht"},
-    {"application/vnd.sealed.ppt",        ".sppt"},
-    {"application/vnd.sealed.tiff",        ".stif"},
-    {"application/vnd.sealed.xls",        ".sxls"},
-    {"application/vnd.sealedmedia.softseal.html",        ".stml"},
-    {"application/vnd.sealedmedia.softseal.pdf",        ".spdf"},
-    {"application/vnd.seemail",        ".see"},
-    {"application/vnd.sema",        ".sema"},
-    {"application/vnd.semd",        ".semd"},
-    {"application/vnd.semf",        ".semf"},
-    {"application/vnd.shade-save-file",        ".ssv"},
-    {"application/vnd.shana.informed.formdata",        ".ifm"},
-    {"application/vnd.shana.informed.formtemplate",        ".itp"},
-    {"application/vnd.shana.informed.interchange",        ".iif"},
-    {"application/vnd.shana.informed.package",        ".ipk"},
-    {"application/vnd.shp",        ".shp"},
-    {"application/vnd.shx",        ".shx"},
-    {"application/vnd.sigrok.session",        ".sr"},
-    {"application/vnd.smaf",        ".mmf"},
-    {"application/vnd.smart.notebook",        ".notebook"},
-    {"application/vnd.smart.teacher",        ".teacher"},
-    {"application/vnd.snesdev-page-table",        ".ptrom"},
-    {"application/vnd.software602.filler.form+xml",        ".fo"},
-    {"application/vnd.software602.filler.form-xml-zip",        ".zfo"},
-    {"application/vnd.solent.sdkm+xml",        ".sdkm"},
-    {"application/vnd.spotfire.dxp",        ".dxp"},
-    {"application/vnd.spotfire.sfs",        ".sfs"},
-    {"application/vnd.sqlite3",        ".sqlite3"},
-    {"application/vnd.stepmania.package",        ".smzip"},
-    {"application/vnd.stepmania.stepchart",        ".sm"},
-    {"application/vnd.sun.wadl+xml",        ".wadl"},
-    {"application/vnd.sun.xml.calc",        ".sxc"},
-    {"application/vnd.sun.xml.calc.template",        ".stc"},
-    {"application/vnd.sun.xml.draw",        ".sxd"},
-    {"application/vnd.sun.xml.draw.template",        ".std"},
-    {"application/vnd.sun.xml.impress",        ".sxi"},
-    {"application/vnd.sun.xml.impress.template",        ".sti"},
-    {"application/vnd.sun.xml.math",        ".sxm"},
-    {"application/vnd.sun.xml.writer",        ".sxw"},
-    {"application/vnd.sun.xml.writer.global",        ".sxg"},
-    {"application/vnd.sun.xml.writer.template",        ".stw"},
-    {"application/vnd.sus-calendar",        ".susp"},
-    {"application/vnd.symbian.install",        ".sis"},
-    {"application/vnd.syncml+xml",        ".xsm"},
-    {"application/vnd.syncml.dm+wbxml",        ".bdm"},
-    {"application/vnd.syncml.dm+xml",        ".xdm"},
-    {"application/vnd.syncml.dmddf+xml",        ".ddf"},
-    {"application/vnd.tao.intent-module-archive",        ".tao"},
-    {"application/vnd.tcpdump.pcap",        ".pcap"},
-    {"application/vnd.theqvd",        ".qvd"},
-    {"application/vnd.think-cell.ppttc+json",        ".ppttc"},
-    {"application/vnd.tml",        ".viaframe"},
-    {"application/vnd.tmobile-livetv",        ".tmo"},
-    {"application/vnd.trid.tpt",        ".tpt"},
-    {"application/vnd.triscape.mxs",        ".mxs"},
-    {"application/vnd.trueapp",        ".tra"},
-    {"application/vnd.ufdl",        ".ufdl"},
-    {"application/vnd.uiq.theme",        ".utz"},
-    {"application/vnd.umajin",        ".umj"},
-    {"application/vnd.unity",        ".unityweb"},
-    {"application/vnd.uoml+xml",        ".uoml"},
-    {"application/vnd.uri-map",        ".urimap"},
-    {"application/vnd.valve.source.material",        ".vmt"},
-    {"application/vnd.vcx",        ".vcx"},
-    {"application/vnd.vd-study",        ".study-inter"},
-    {"application/vnd.vectorworks",        ".vwx"},
-    {"application/vnd.veryant.thin",        ".isws"},
-    {"application/vnd.ves.encrypted",        ".VES"},
-    {"application/vnd.vidsoft.vidconference",        ".vsc"},
-    {"application/vnd.visio",        ".vsw"},
-    {"application/vnd.visionary",        ".vis"},
-    {"application/vnd.vsf",        ".vsf"},
-    {"application/vnd.wap.mms-message",        ".mms"},
-    {"application/vnd.wap.sic",        ".sic"},
-    {"application/vnd.wap.slc",        ".slc"},
-    {"application/vnd.wap.wbxml",        ".wbxml"},
-    {"application/vnd.wap.wmlc",        ".wmlc"},
-    {"application/vnd.wap.wmlscriptc",        ".wmlsc"},
-    {"application/vnd.webturbo",        ".wtb"},
-    {"application/vnd.wfa.p2p",        ".p2p"},
-    {"application/vnd.wfa.wsc",        ".wsc"},
-    {"application/vnd.wmc",        ".wmc"},
-    {"application/vnd.wolfram.mathematica.package",        ".m"},
-    {"application/vnd.wolfram.player",        ".nbp"},
-    {"application/vnd.wordperfect",        ".wpd"},
-    {"application/vnd.wqd",        ".wqd"},
-    {"application/vnd.wt.stf",        ".stf"},
-    {"application/vnd.wv.csp+wbxml",        ".wv"},
-    {"application/vnd.xara",        ".xar"},
-    {"application/vnd.xfdl",        ".xfdl"},
-    {"application/vnd.xmpie.cpkg",        ".cpkg"},
-    {"application/vnd.xmpie.dpkg",        ".dpkg"},
-    {"application/vnd.xmpie.ppkg",        ".ppkg"},
-    {"application/vnd.xmpie.xlim",        ".xlim"},
-    {"application/vnd.yamaha.hv-dic",        ".hvd"},
-    {"application/vnd.yamaha.hv-script",        ".hvs"},
-    {"application/vnd.yamaha.hv-voice",        ".hvp"},
-    {"application/vnd.yamaha.openscoreformat",        ".osf"},
-    {"application/vnd.yamaha.smaf-audio",        ".saf"},
-    {"application/vnd.yamaha.smaf-phrase",        ".spf"},
-    {"application/vnd.yaoweme",        ".yme"},
-    {"application/vnd.yellowriver-custom-menu",        ".cmp"},
-    {"application/vnd.zul",        ".zirz"},
-    {"application/vnd.zzazz.deck+xml",        ".zaz"},
-    {"application/x-annodex",        ".anx"},
-    {"application/x-bcpio",        ".bcpio"},
-    {"application/x-bittorrent",        ".torrent"},
-    {"application/x-bzip2",        ".bz2"},
-    {"application/x-cdlink",        ".vcd"},
-    {"application/x-chrome-extension",        ".crx"},
-    {"application/x-cpio",        ".cpio"},
-    {"application/x-csh",        ".csh"},
-    {"application/x-director",        ".dxr"},
-    {"application/x-dvi",        ".dvi"},
-    {"application/x-futuresplash",        ".spl"},
-    {"application/x-gtar",        ".gtar"},
-    {"application/x-hdf",        ".hdf"},
-    {"application/x-java-archive",        ".jar"},
-    {"application/x-java-jnlp-file",        ".jnlp"},
-    {"application/x-java-pack200",        ".pack"},
-    {"application/x-killustrator",        ".kil"},
-    {"application/x-latex",        ".latex"},
-    {"application/x-netcdf",        ".nc"},
-    {"application/x-perl",        ".pl"},
-    {"application/x-rpm",        ".rpm"},
-    {"application/x-sh",        ".sh"},
-    {"application/x-shar",        ".shar"},
-    {"application/x-stuffit",        ".sit"},
-    {"application/x-sv4cpio",        ".sv4cpio"},
-    {"application/x-sv4crc",        ".sv4crc"},
-    {"application/x-tar",        ".tar"},
-    {"application/x-tcl",        ".tcl"},
-    {"application/x-tex",        ".tex"},
-    {"application/x-texinfo",        ".texinfo"},
-    {"application/x-troff-man",        ".man"},
-    {"application/x-troff-me",        ".me"},
-    {"application/x-troff-ms",        ".ms"},
-    {"application/x-ustar",        ".ustar"},
-    {"application/x-wais-source",        ".src"},
-    {"application/x-xpinstall",        ".xpi"},
-    {"application/x-xspf+xml",        ".xspf"},
-    {"application/x-xz",        ".xz"},
-    {"audio/32kadpcm",        ".726"},
-    {"audio/aiff",        ".aiff"},
-    {"audio/amr",        ".amr"},
-    {"audio/amr-wb",        ".awb"},
-    {"audio/annodex",        ".axa"},
-    {"audio/atrac-advanced-lossless",        ".aal"},
-    {"audio/atrac-x",        ".atx"},
-    {"audio/atrac3",        ".omg"},
-    {"audio/evrc",        ".evc"},
-    {"audio/evrcb",        ".evb"},
-    {"audio/evrcnw",        ".enw"},
-    {"audio/evrcwb",        ".evw"},
-    {"audio/l16",        ".l16"},
-    {"audio/smv",        ".smv"},
-    {"audio/aac",        ".aac"},
-    {"audio/ac3",        ".ac3"},
-    {"audio/asc",        ".acn"},
-    {"audio/basic",        ".snd"},
-    {"audio/dls",        ".dls"},
-    {"audio/flac",        ".flac"},
-    {"audio/ilbc",        ".lbc"},
-    {"audio/matroska",        ".mka"},
-    {"audio/mhas",        ".mhas"},
-    {"audio/midi",        ".midi"},
-    {"audio/mod",        ".mod"},
-    {"audio/mobile-xmf",        ".mxmf"},
-    {"audio/mp4",        ".m4a"},
-    {"audio/mpeg",        ".mp3"},
-    {"audio/mpegurl",        ".m3u"},
-    {"audio/ms-wax",        ".wax"},
-    {"audio/ms-wma",        ".wma"},
-    {"audio/ogg",        ".ogg"},
-    {"audio/prs.sid",        ".sid"},
-    {"audio/qcelp",        ".qcp"},
-    {"audio/s3m",        ".s3m"},
-    {"audio/stm",        ".stm"},
-    {"audio/usac",        ".xhe"},
-    {"audio/vnd.audikoz",        ".koz"},
-    {"audio/vnd.dece.audio",        ".uvva"},
-    {"audio/vnd.digital-winds",        ".eol"},
-    {"audio/vnd.dolby.mlp",        ".mlp"},
-    {"audio/vnd.dts",        ".dts"},
-    {"audio/vnd.dts.hd",        ".dtshd"},
-    {"audio/vnd.everad.plj",        ".plj"},
-    {"audio/vnd.lucent.voice",        ".lvp"},
-    {"audio/vnd.ms-playready.media.pya",        ".pya"},
-    {"audio/vnd.nortel.vbk",        ".vbk"},
-    {"audio/vnd.nuera.ecelp4800",        ".ecelp4800"},
-    {"audio/vnd.nuera.ecelp7470",        ".ecelp7470"},
-    {"audio/vnd.nuera.ecelp9600",        ".ecelp9600"},
-    {"audio/vnd.presonus.multitrack",        ".multitrack"},
-    {"audio/vnd.rip",        ".rip"},
-    {"audio/vnd.sealedmedia.softseal.mpeg",        ".smp3"},
-    {"audio/wav",        ".wav"},
-    {"audio/pn-realaudio",        ".rm"},
-    {"audio/realaudio",        ".ra"},
-    {"chemical/x-xyz",        ".xyz"},
-    {"font/collection",        ".ttc"},
-    {"font/otf",        ".otf"},
-    {"font/ttf",        ".ttf"},
-    {"font/woff",        ".woff"},
-    {"font/woff2",        ".woff2"},
-    {"image/aces",        ".exr"},
-    {"image/avci",        ".avci"},
-    {"image/avcs",        ".avcs"},
-    {"image/bmp",        ".dib"},
-    {"image/cgm",        ".cgm"},
-    {"image/dicom-rle",        ".drle"},
-    {"image/emf",        ".emf"},
-    {"image/fits",        ".fts"},
-    {"image/gif",        ".gif"},
-    {"image/heic",        ".heic"},
-    {"image/heic-sequence",        ".heics"},
-    {"image/heif",        ".heif"},
-    {"image/heif-sequence",        ".heifs"},
-    {"image/hej2k",        ".hej2"},
-    {"image/hsj2",        ".hsj2"},
-    {"image/ief",        ".ief"},
-    {"image/jls",        ".jls"},
-    {"image/jp2",        ".jpg2"},
-    {"image/jpeg",        ".jpg"},
-    {"image/jph",        ".jph"},
-    {"image/jphc",        ".jhc"},
-    {"image/jpm",        ".jpm"},
-    {"image/jpx",        ".jpx"},
-    {"image/jxr",        ".jxr"},
-    {"image/jxra",        ".jxra"},
-    {"image/jxrs",        ".jxrs"},
-    {"image/jxs",        ".jxs"},
-    {"image/jxsc",        ".jxsc"},
-    {"image/jxsi",        ".jxsi"},
-    {"image/jxss",        ".jxss"},
-    {"image/ktx",        ".ktx"},
-    {"image/png",        ".png"},
-    {"image/prs.btif",        ".btif"},
-    {"image/prs.pti",        ".pti"},
-    {"image/svg+xml",        ".svgz"},
-    {"image/t38",        ".t38"},
-    {"image/tiff",        ".tiff"},
-    {"image/tiff-fx",        ".tfx"},
-    {"image/webp",        ".webp"},
-    {"image/wmf",        ".wmf"},
-    {"image/vnd.adobe.photoshop",        ".psd"},
-    {"image/vnd.airzip.accelerator.azv",        ".azv"},
-    {"image/vnd.dece.graphic",        ".uvvi"},
-    {"image/vnd.djvu",        ".djvu"},
-    {"image/vnd.dwg",        ".dwg"},
-    {"image/vnd.dxf",        ".dxf"},
-    {"image/vnd.fastbidsheet",        ".fbs"},
-    {"image/vnd.fpx",        ".fpx"},
-    {"image/vnd.fst",        ".fst"},
-    {"image/vnd.fujixerox.edmics-mmr",        ".mmr"},
-    {"image/vnd.fujixerox.edmics-rlc",        ".rlc"},
-    {"image/vnd.globalgraphics.pgb",        ".pgb"},
-    {"image/vnd.microsoft.icon",        ".ico"},
-    {"image/vnd.mozilla.apng",        ".apng"},
-    {"image/vnd.ms-modi",        ".mdi"},
-    {"image/vnd.radiance",        ".xyze"},
-    {"image/vnd.sealed.png",        ".spng"},
-    {"image/vnd.sealedmedia.softseal.gif",        ".sgif"},
-    {"image/vnd.sealedmedia.softseal.jpg",        ".sjpg"},
-    {"image/vnd.tencent.tap",        ".tap"},
-    {"image/vnd.valve.source.texture",        ".vtf"},
-    {"image/vnd.wap.wbmp",        ".wbmp"},
-    {"image/vnd.xiff",        ".xif"},
-    {"image/vnd.zbrush.pcx",        ".pcx"},
-    {"image/x-cmu-raster",        ".ras"},
-    {"image/x-portable-anymap",        ".pnm"},
-    {"image/x-portable-bitmap",        ".pbm"},
-    {"image/x-portable-graymap",        ".pgm"},
-    {"image/x-portable-pixmap",        ".ppm"},
-    {"image/x-rgb",        ".rgb"},
-    {"image/x-targa",        ".tga"},
-    {"image/x-xbitmap",        ".xbm"},
-    {"image/x-xpixmap",        ".xpm"},
-    {"image/x-xwindowdump",        ".xwd"},
-    {"message/global",        ".u8msg"},
-    {"message/global-delivery-status",        ".u8dsn"},
-    {"message/global-disposition-notification",        ".u8mdn"},
-    {"message/global-headers",        ".u8hdr"},
-    {"message/rfc822",        ".mail"},
-    {"model/gltf+json",        ".gltf"},
-    {"model/gltf-binary",        ".glb"},
-    {"model/iges",        ".igs"},
-    {"model/mesh",        ".silo"},
-    {"model/mtl",        ".mtl"},
-    {"model/obj",        ".obj"},
-    {"model/stl",        ".stl"},
-    {"model/vrml",        ".wrl"},
-    {"model/x3d+xml",        ".x3db"},
-    {"model/x3d-vrml",        ".x3dvz"},
-    {"model/vnd.collada+xml",        ".dae"},
-    {"model/vnd.dwf",        ".dwf"},
-    {"model/vnd.gdl",        ".win"},
-    {"model/vnd.gtw",        ".gtw"},
-    {"model/vnd.moml+xml",        ".moml"},
-    {"model/vnd.mts",        ".mts"},
-    {"model/vnd.opengex",        ".ogex"},
-    {"model/vnd.usdz+zip",        ".usdz"},
-    {"model/vnd.valve.source.compiled-map",        ".bsp"},
-    {"model/vnd.vtu",        ".vtu"},
-    {"multipart/voice-message",        ".vpm"},
-    {"multipart/vnd.bint.med-plus",        ".bmed"},
-    {"text/cache-manifest",        ".manifest"},
-    {"text/calendar",        ".ifb"},
-    {"text/css; charset=utf-8",        ".css"},
-    {"text/csv; charset=utf-8",        ".csv"},
-    {"text/csv-schema",        ".csvs"},
-    {"text/dns",        ".zone"},
-    {"text/html",        ".html"},
-    {"text/html; charset=utf-8",        ".html"},
-    {"text/html-sandboxed",        ".sandboxed"},
-    {"text/jcr-cnd",        ".cnd"},
-    {"text/markdown; charset=utf-8",        ".md"},
-    {"text/mizar",        ".miz"},
-    {"text/n3",        ".n3"},
-    {"text/plain; charset=utf-8",        ".txt"},
-    {"text/provenance-notation",        ".provn"},
-    {"text/prs.fallenstein.rst",        ".rst"},
-    {"text/prs.lines.tag",        ".tag"},
-    {"text/richtext",        ".rtx"},
-    {"text/sgml",        ".sgml"},
-    {"text/tab-separated-values",        ".tsv"},
-    {"text/troff",        ".tr"},
-    {"text/turtle",        ".ttl"},
-    {"text/uri-list",        ".uris"},
-    {"text/vcard",        ".vcf"},
-    {"text/vtt",        ".vtt"},
-    {"text/xml",        ".xml"},
-    {"text/xml-external-parsed-entity",        ".ent"},
-    {"text/vnd.dmclientscript",        ".dms"},
-    {"text/vnd.a",        ".a"},
-    {"text/vnd.abc",        ".abc"},
-    {"text/vnd.ascii-art",        ".ascii"},
-    {"text/vnd.debian.copyright",        ".copyright"},
-    {"text/vnd.dvb.subtitle",        ".sub"},
-    {"text/vnd.esmertec.theme-descriptor",        ".jtd"},
-    {"text/vnd.ficlab.flt",        ".flt"},
-    {"text/vnd.fly",        ".fly"},
-    {"text/vnd.fmi.flexstor",        ".flx"},
-    {"text/vnd.graphviz",        ".gv"},
-    {"text/vnd.hgl",        ".hgl"},
-    {"text/vnd.in3d.3dml",        ".3dml"},
-    {"text/vnd.in3d.spot",        ".spot"},
-    {"text/vnd.ms-mediapackage",        ".mpf"},
-    {"text/vnd.net2phone.commcenter.command",        ".ccc"},
-    {"text/vnd.senx.warpscript",        ".mc2"},
-    {"text/vnd.si.uricatalogue",        ".uric"},
-    {"text/vnd.sosi",        ".sos"},
-    {"text/vnd.sun.j2me.app-descriptor",        ".jad"},
-    {"text/vnd.trolltech.linguist",        ".ts"},
-    {"text/vnd.wap.si",        ".si"},
-    {"text/vnd.wap.sl",        ".sl"},
-    {"text/vnd.wap.wml",        ".wml"},
-    {"text/vnd.wap.wmlscript",        ".wmls"},
-    {"text/x-makefile; charset=utf-8",        "Makefile"},
-    {"text/x-pod",        ".pod"},
-    {"text/x-setext",        ".etx"},
-    {"video/3gpp",        ".3gpp"},
-    {"video/3gpp2",        ".3gpp2"},
-    {"video/annodex",        ".axv"},
-    {"video/flv",        ".flv"},
-    {"video/iso.segment",        ".m4s"},
-    {"video/javafx",        ".fxm"},
-    {"video/matroska",        ".mkv"},
-    {"video/matroska-3d",        ".mk3d"},
-    {"video/mj2",        ".mjp2"},
-    {"video/mp4",        ".mp4"},
-    {"video/mpeg",        ".mpg"},
-    {"video/ms-asf",        ".asx"},
-    {"video/ms-wm",        ".wm"},
-    {"video/ms-wmv",        ".wmv"},
-    {"video/ms-wmx",        ".wmx"},
-    {"video/ms-wvx",        ".wvx"},
-    {"video/msvideo",        ".avi"},
-    {"video/ogg",        ".ogv"},
-    {"video/quicktime",        ".qt"},
-    {"video/sgi-movie",        ".movie"},
-    {"video/webm",        ".webm"},
-    {"video/vnd.dece.hd",        ".uvvh"},
-    {"video/vnd.dece.mobile",        ".uvvm"},
-    {"video/vnd.dece.mp4",        ".uvvu"},
-    {"video/vnd.dece.pd",        ".uvvp"},
-    {"video/vnd.dece.sd",        ".uvvs"},
-    {"video/vnd.dece.video",        ".uvvv"},
-    {"video/vnd.dvb.file",        ".dvb"},
-    {"video/vnd.fvt",        ".fvt"},
-    {"video/vnd.mpegurl",        ".mxu"},
-    {"video/vnd.ms-playready.media.pyv",        ".pyv"},
-    {"video/vnd.nokia.interleaved-multimedia",        ".nim"},
-    {"video/vnd.radgamettools.bink",        ".bk2"},
-    {"video/vnd.radgamettools.smacker",        ".smk"},
-    {"video/vnd.sealed.mpeg1",        ".smpg"},
-    {"video/vnd.sealed.mpeg4",        ".s14"},
-    {"video/vnd.sealed.swf",        ".sswf"},
-    {"video/vnd.sealedmedia.softseal.mov",        ".smov"},
-    {"video/vnd.vivo",        ".viv"},
-    {"video/vnd.youtube.yt",        ".yt"},
-    {"x-conference/x-cooltalk",        ".ice"},
-    {"x-epoc/x-sisx-app",        ".sisx"},
-};
+    constexpr uint32_t hash(std::string_view key, uint32_t seed)
+    {
+        uint32_t h = 2166136261u ^ seed;
+        for (char c : key) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    inline constexpr uint16_t type_seeds[] = {
+        3, 2, 3, 9, 2, 13, 7, 50, 1, 8, 0, 150,
+        3, 2, 12, 3, 19, 1, 61, 42, 103, 4, 41, 28,
+        3, 11, 4, 20, 19, 2, 15, 1, 19, 6, 2, 22,
+        3, 17, 183, 10, 57, 4, 43, 5, 8, 2, 3, 116,
+        122, 17, 88, 1, 5, 8, 20, 29, 87, 1, 6, 11,
+        2, 78, 3, 25, 9, 43, 81, 44, 16, 19, 6, 1,
+        42, 71, 7, 18, 17, 1, 1, 2, 41, 162, 23, 15,
+        4, 17, 14, 17, 55, 30, 130, 7, 57, 2, 3, 196,
+        44, 2, 198, 0, 37, 28, 163, 9, 16, 9, 1, 16,
+        233, 17, 45, 48, 34, 2, 58, 1, 16, 4, 31, 5,
+        9, 58, 6, 28, 56, 109, 3, 155, 7, 105, 155, 19,
+        35, 547, 21, 3, 118, 10, 327, 0, 122, 139, 1, 66,
+        3, 1, 101, 3, 12, 66, 113, 4, 30, 24, 709, 4,
+        16, 88, 0, 68, 6, 125, 379, 117, 238, 17, 116, 0,
+        56, 105, 60, 46, 250, 64, 1, 22, 10, 1, 29, 345,
+        131, 27, 5, 608, 28, 14, 13, 230, 510, 209, 59, 193,
+        493, 9, 33, 35, 316, 195, 135, 29, 106, 8, 201, 80,
+        15, 0, 160, 170, 3, 646, 3, 12, 1, 28, 589, 27,
+        1, 6, 60, 198, 520, 39, 18, 4, 47, 585, 125, 11,
+        916, 16, 47, 2, 181, 19, 334, 56, 43, 4, 176, 2884,
+        351, 20, 15, 721, 249, 3, 7, 12, 184, 61, 3, 60,
+        43, 0, 20, 247,
+    };
+
+    inline constexpr entry type_slots[] = {
+        {"message/global-disposition-notification", ".u8mdn"},
+        {"application/vnd.sealed.doc", ".sdoc"},
+        {"model/vrml", ".wrl"},
+        {"application/vnd.nimn", ".nimn"},
+        {"application/x-xspf+xml", ".xspf"},
+        {"image/prs.btif", ".btif"},
+        {"application/xslt+xml", ".xslt"},
+        {"audio/flac", ".flac"},
+        {"video/vnd.sealedmedia.softseal.mov", ".smov"},
+        {"application/vnd.yamaha.smaf-phrase", ".spf"},
+        {"video/vnd.ms-playready.media.pyv", ".pyv"},
+        {"model/vnd.valve.source.compiled-map", ".bsp"},
+        {"application/vnd.sealed.eml", ".seml"},
+        {"application/geo+json", ".geojson"},
+        {"application/x-gtar-compressed", ".tbz"},
+        {"application/vnd.onepagertat", ".tat"},
+        {"application/vnd.intercon.formnet", ".xpx"},
+        {"application/hyperstudio", ".stk"},
+        {"image/x-rgb", ".rgb"},
+        {"image/vnd.valve.source.texture", ".vtf"},
+        {"application/vnd.jam", ".jam"},
+        {"text/vnd.in3d.spot", ".spot"},
+        {"application/ocsp-response", ".ors"},
+        {"application/vnd.accpac.simply.aso", ".aso"},
+        {"application/vnd.solent.sdkm+xml", ".sdkm"},
+        {"application/simple-filter+xml", ".cl"},
+        {"application/ecmascript", ".es"},
+        {"image/jxrs", ".jxrs"},
+        {"application/vnd.sun.xml.writer", ".sxw"},
+        {"application/vnd.groove-help", ".ghf"},
+        {"application/x-tcl", ".tcl"},
+        {"application/pkixcmp", ".pki"},
+        {"application/vnd.oasis.opendocument.text", ".odt"},
+        {"application/xhtml+xml", ".xhtml"},
+        {"application/vnd.ieee.1905", ".1905.1"},
+        {"application/vnd.onepagertatx", ".tatx"},
+        {"application/vnd.previewsystems.box", ".vbox"},
+        {"application/vnd.joost.joda-archive", ".joda"},
+        {"application/vnd.oma.drm.content", ".dcf"},
+        {"application/vnd.framemaker", ".fm"},
+        {"application/vnd.is-xpr", ".xpr"},
+        {"application/vnd.osgi.subsystem", ".esa"},
+        {"application/route-s-tsid+xml", ".sls"},
+        {"application/vnd.sar", ".SAR"},
+        {"audio/aiff", ".aiff"},
+        {"application/vnd.wqd", ".wqd"},
+        {"application/x-wais-source", ".src"},
+        {"video/matroska", ".mkv"},
+        {"application/sdp", ".sdp"},
+        {"video/3gpp2", ".3gpp2"},
+        {"application/link-format", ".wlnk"},
+        {"application/senml-etch+json", ".senml-etchj"},
+        {"application/vnd.onepagertatp", ".tatp"},
+        {"application/dicom", ".dcm"},
+        {"audio/matroska", ".mka"},
+        {"application/jrd+json", ".jrd"},
+        {"application/pgp-encrypted", ".pgp"},
+        {"application/vnd.rainstor.data", ".tree"},
+        {"application/oda", ".oda"},
+        {"application/vnd.cluetrust.cartomobile-config", ".c11amc"},
+        {"application/vnd.cinderella", ".cdy"},
+        {"text/css; charset=utf-8", ".css"},
+        {"application/yang", ".yang"},
+        {"", ""},
+        {"application/vnd.eszigno3+xml", ".et3"},
+        {"application/vnd.data-vision.rdz", ".rdz"},
+        {"video/quicktime", ".qt"},
+        {"application/vnd.debian.binary-package", ".udeb"},
+        {"image/x-portable-pixmap", ".ppm"},
+        {"application/vnd.multiad.creator.cif", ".cif"},
+        {"video/ms-wm", ".wm"},
+        {"", ""},
+        {"image/x-xbitmap", ".xbm"},
+        {"application/vnd.kidspiration", ".kia"},
+        {"application/font-tdpfr", ".pfr"},
+        {"application/vnd.igloader", ".igl"},
+        {"application/vnd.theqvd", ".qvd"},
+        {"text/provenance-notation", ".provn"},
+        {"video/vnd.sealed.mpeg4", ".s14"},
+        {"application/cdmi-object", ".cdmio"},
+        {"application/sensml+json", ".sensml"},
+        {"model/x3d+xml", ".x3db"},
+        {"application/vnd.lotus-wordpro", ".sam"},
+        {"audio/vnd.nuera.ecelp4800", ".ecelp4800"},
+        {"audio/evrcnw", ".enw"},
+        {"application/vnd.ctc-posml", ".pml"},
+        {"application/vnd.audiograph", ".aep"},
+        {"text/csv-schema", ".csvs"},
+        {"application/vnd.vcx", ".vcx"},
+        {"application/swid+xml", ".swidtag"},
+        {"application/vnd.vectorworks", ".vwx"},
+        {"application/vnd.geonext", ".gxt"},
+        {"application/vnd.balsamiq.bmpr", ".bmpr"},
+        {"text/vnd.graphviz", ".gv"},
+        {"application/vnd.spotfire.dxp", ".dxp"},
+        {"application/vnd.evolv.ecig.profile", ".ecigprofile"},
+        {"application/lost+xml", ".lostxml"},
+        {"application/xcap-ns+xml", ".xns"},
+        {"application/tamp-apex-update-confirm", ".auc"},
+        {"application/vnd.iccprofile", ".icm"},
+        {"application/vnd.google-earth.kmz", ".kmz"},
+        {"application/odx", ".odx"},
+        {"application/yin+xml", ".yin"},
+        {"application/vnd.qualcomm.brew-app-res", ".bar"},
+        {"application/vnd.acucorp", ".atc"},
+        {"application/pkcs10", ".p10"},
+        {"application/vnd.ms-asf", ".asf"},
+        {"image/png", ".png"},
+        {"application/vnd.criticaltools.wbs+xml", ".wbs"},
+        {"", ""},
+        {"application/vnd.visionary", ".vis"},
+        {"application/mf4", ".mf4"},
+        {"application/vnd.xfdl", ".xfdl"},
+        {"application/vnd.multiad.creator", ".crtr"},
+        {"video/vnd.sealed.mpeg1", ".smpg"},
+        {"application/vnd.ms-excel.sheet.binary.macroenabled.12", ".xlsb"},
+        {"application/vnd.nokia.n-gage.ac+xml", ".ac"},
+        {"application/vnd.wolfram.player", ".nbp"},
+        {"application/vnd.xmpie.ppkg", ".ppkg"},
+        {"application/dashdelta", ".mpdd"},
+        {"application/x-xpinstall", ".xpi"},
+        {"application/vnd.las.las+json", ".lasjson"},
+        {"message/global", ".u8msg"},
+        {"application/vnd.lotus-1-2-3", ".wk4"},
+        {"application/vnd.wap.wmlc", ".wmlc"},
+        {"application/vnd.fluxtime.clip", ".ftc"},
+        {"image/vnd.airzip.accelerator.azv", ".azv"},
+        {"application/vnd.comicbook-rar", ".cbr"},
+        {"application/vnd.rar", ".rar"},
+        {"application/exi", ".exi"},
+        {"", ""},
+        {"application/calendar+xml", ".xcs"},
+        {"multipart/vnd.bint.med-plus", ".bmed"},
+        {"application/vnd.kde.karbon", ".karbon"},
+        {"audio/vnd.sealedmedia.softseal.mpeg", ".smp3"},
+        {"application/vnd.shana.informed.interchange", ".iif"},
+        {"application/sparql-query", ".rq"},
+        {"message/global-headers", ".u8hdr"},
+        {"application/atomcat+xml", ".atomcat"},
+        {"application/x-bzip2", ".bz2"},
+        {"image/jls", ".jls"},
+        {"application/vnd.banana-accounting", ".ac2"},
+        {"application/ocsp-request", ".orq"},
+        {"application/vnd.zzazz.deck+xml", ".zaz"},
+        {"application/ld+json", ".jsonld"},
+        {"application/vnd.isac.fcs", ".fcs"},
+        {"application/vnd.clonk.c4group", ".c4u"},
+        {"application/x-director", ".dxr"},
+        {"audio/vnd.presonus.multitrack", ".multitrack"},
+        {"application/pkcs8", ".p8"},
+        {"application/vnd.immervision-ivp", ".ivp"},
+        {"application/vnd.osa.netdeploy", ".ndc"},
+        {"application/fdt+xml", ".fdt"},
+        {"application/andrew-inset", ".ez"},
+        {"application/mets+xml", ".mets"},
+        {"application/cdmi-queue", ".cdmiq"},
+        {"application/vnd.mseq", ".mseq"},
+        {"application/pgp-signature", ".sig"},
+        {"application/vnd.wordperfect", ".wpd"},
+        {"application/vnd.immervision-ivu", ".ivu"},
+        {"application/senml+json", ".senml"},
+        {"application/vnd.kde.kpresenter", ".kpt"},
+        {"application/vnd.trid.tpt", ".tpt"},
+        {"application/vnd.openxmlformats-officedocument.presentationml.template", ".potx"},
+        {"image/t38", ".t38"},
+        {"application/vnd.collabio.xodocuments.presentation-template", ".xotp"},
+        {"image/x-xwindowdump", ".xwd"},
+        {"application/vnd.mozilla.xul+xml", ".xul"},
+        {"video/msvideo", ".avi"},
+        {"application/vnd.micrografx.igx", ".igx"},
+        {"application/vnd.intu.qfx", ".qfx"},
+        {"application/vnd.sun.xml.writer.template", ".stw"},
+        {"application/vnd.quobject-quoxdocument", ".quox"},
+        {"application/timestamp-reply", ".tsr"},
+        {"application/octet-stream", ".bin"},
+        {"", ""},
+        {"audio/midi", ".midi"},
+        {"application/epub+zip", ".epub"},
+        {"application/vnd.macports.portpkg", ".portpkg"},
+        {"image/bmp", ".dib"},
+        {"application/x-annodex", ".anx"},
+        {"application/vnd.ms-project", ".mpt"},
+        {"audio/vnd.dts.hd", ".dtshd"},
+        {"application/vnd.nokia.radio-presets", ".rpss"},
+        {"audio/vnd.digital-winds", ".eol"},
+        {"application/vnd.noblenet-web", ".nnw"},
+        {"application/xcap-error+xml", ".xer"},
+        {"application/vnd.llamagraphics.life-balance.desktop", ".lbd"},
+        {"application/zstd", ".zst"},
+        {"application/vnd.kodak-descriptor", ".sse"},
+        {"application/vnd.osgi.dp", ".dp"},
+        {"video/matroska-3d", ".mk3d"},
+        {"audio/dls", ".dls"},
+        {"application/vnd.groove-vcard", ".vcg"},
+        {"application/vnd.ms-ims", ".ims"},
+        {"audio/l16", ".l16"},
+        {"application/vnd.collabio.xodocuments.spreadsheet-template", ".xots"},
+        {"application/vnd.ms-works", ".wps"},
+        {"video/vnd.dece.pd", ".uvvp"},
+        {"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet", ".xlsx"},
+        {"video/vnd.fvt", ".fvt"},
+        {"text/vnd.ficlab.flt", ".flt"},
+        {"application/vnd.yamaha.smaf-audio", ".saf"},
+        {"application/x-troff-ms", ".ms"},
+        {"application/vnd.uiq.theme", ".utz"},
+        {"application/vnd.oma.dd+xml", ".dd"},
+        {"application/scvp-vp-response", ".spp"},
+        {"application/cdmi-capability", ".cdmia"},
+        {"image/ief", ".ief"},
+        {"application/vnd.smaf", ".mmf"},
+        {"application/vnd.uri-map", ".urimap"},
+        {"application/vnd.syncml.dm+xml", ".xdm"},
+        {"application/sensml+xml", ".sensmlx"},
+        {"video/annodex", ".axv"},
+        {"application/vnd.sealed.csf", ".scsf"},
+        {"application/vnd.cluetrust.cartomobile-config-pkg", ".c11amz"},
+        {"application/vnd.unity", ".unityweb"},
+        {"audio/atrac-advanced-lossless", ".aal"},
+        {"application/vnd.onepagertamx", ".tamx"},
+        {"application/n-triples", ".nt"},
+        {"text/vnd.dvb.subtitle", ".sub"},
+        {"application/vnd.trueapp", ".tra"},
+        {"application/vnd.ecowin.chart", ".mag"},
+        {"application/vnd.airzip.filesecure.azf", ".azf"},
+        {"application/provenance+xml", ".provx"},
+        {"application/x-perl", ".pl"},
+        {"application/vnd.afpc.modca-overlay", ".ovl"},
+        {"application/sql", ".sql"},
+        {"application/scim+json", ".scim"},
+        {"image/vnd.ms-modi", ".mdi"},
+        {"application/wasm", ".wasm"},
+        {"application/vnd.dece.ttml+xml", ".uvvt"},
+        {"video/vnd.radgamettools.smacker", ".smk"},
+        {"application/vnd.crick.clicker.template", ".clkt"},
+        {"application/pskc+xml", ".pskcxml"},
+        {"application/vnd.umajin", ".umj"},
+        {"application/vnd.aristanetworks.swi", ".swi"},
+        {"application/vnd.ezpix-package", ".ez3"},
+        {"text/html-sandboxed", ".sandboxed"},
+        {"application/vnd.frogans.fnc", ".fnc"},
+        {"application/vnd.tcpdump.pcap", ".pcap"},
+        {"application/vnd.recordare.musicxml", ".mxl"},
+        {"image/vnd.fst", ".fst"},
+        {"application/vnd.mif", ".mif"},
+        {"application/vnd.wap.wbxml", ".wbxml"},
+        {"application/vnd.fujixerox.docuworks.container", ".xct"},
+        {"application/msword", ".doc"},
+        {"application/vnd.ms-powerpoint.template.macroenabled.12", ".potm"},
+        {"message/global-delivery-status", ".u8dsn"},
+        {"application/sparql-results+xml", ".srx"},
+        {"image/vnd.globalgraphics.pgb", ".pgb"},
+        {"image/vnd.djvu", ".djvu"},
+        {"application/cbor", ".cbor"},
+        {"application/ogg", ".ogx"},
+        {"image/x-portable-anymap", ".pnm"},
+        {"text/vnd.wap.wmlscript", ".wmls"},
+        {"application/cccex", ".c3ex"},
+        {"application/vnd.fujixerox.ddd", ".ddd"},
+        {"application/xml-dtd", ".dtd"},
+        {"application/sieve", ".siv"},
+        {"text/xml-external-parsed-entity", ".ent"},
+        {"", ""},
+        {"application/vnd.3gpp2.sms", ".sms"},
+        {"application/vnd.3gpp.pic-bw-var", ".pvb"},
+        {"application/vnd.adobe.flash.movie", ".swf"},
+        {"application/mp21", ".mp21"},
+        {"", ""},
+        {"application/prs.xsf+xml", ".xsf"},
+        {"application/vnd.ericsson.quickcall", ".qcall"},
+        {"audio/wav", ".wav"},
+        {"application/vnd.sun.xml.writer.global", ".sxg"},
+        {"application/vnd.yellowriver-custom-menu", ".cmp"},
+        {"", ""},
+        {"application/vnd.citationstyles.style+xml", ".csl"},
+        {"video/ms-asf", ".asx"},
+        {"image/jp2", ".jpg2"},
+        {"application/geopackage+sqlite3", ".gpkg"},
+        {"video/mj2", ".mjp2"},
+        {"video/ms-wvx", ".wvx"},
+        {"application/pls+xml", ".pls"},
+        {"", ""},
+        {"application/vnd.americandynamics.acc", ".acc"},
+        {"text/richtext", ".rtx"},
+        {"application/vnd.contact.cmsg", ".cdbcmsg"},
+        {"text/vnd.senx.warpscript", ".mc2"},
+        {"application/vnd.oasis.opendocument.formula", ".odf"},
+        {"audio/vnd.nuera.ecelp7470", ".ecelp7470"},
+        {"image/jpm", ".jpm"},
+        {"application/vnd.google-earth.kml+xml", ".kml"},
+        {"application/cpl+xml", ".cpl"},
+        {"application/owl+xml", ".owx"},
+        {"application/vnd.ims.imsccv1p1", ".imscc"},
+        {"text/x-pod", ".pod"},
+        {"application/rss+xml", ".rss"},
+        {"video/vnd.radgamettools.bink", ".bk2"},
+        {"application/pkcs12", ".pfx"},
+        {"application/shf+xml", ".shf"},
+        {"application/vnd.shana.informed.package", ".ipk"},
+        {"text/vnd.debian.copyright", ".copyright"},
+        {"application/vnd.wap.slc", ".slc"},
+        {"application/vnd.piaccess.application-license", ".pil"},
+        {"application/vnd.logipipe.circuit+zip", ".lcs"},
+        {"application/vnd.semd", ".semd"},
+        {"application/x-rpm", ".rpm"},
+        {"text/html", ".html"},
+        {"application/vnd.3gpp.pic-bw-small", ".psb"},
+        {"application/javascript", ".js"},
+        {"application/vnd.lotus-notes", ".ntf"},
+        {"application/pkix-pkipath", ".pkipath"},
+        {"application/emotionml+xml", ".emotionml"},
+        {"application/tamp-sequence-adjust-confirm", ".sac"},
+        {"application/x-cdlink", ".vcd"},
+        {"application/srgs", ".gram"},
+        {"text/mizar", ".miz"},
+        {"", ""},
+        {"image/jxss", ".jxss"},
+        {"application/widget", ".wgt"},
+        {"application/scvp-cv-response", ".scs"},
+        {"application/vnd.mobius.mbk", ".mbk"},
+        {"model/vnd.gdl", ".win"},
+        {"application/vnd.evolv.ecig.settings", ".ecig"},
+        {"video/3gpp", ".3gpp"},
+        {"application/vnd.exstream-package", ".pub"},
+        {"application/vnd.xara", ".xar"},
+        {"image/jxsc", ".jxsc"},
+        {"application/vnd.ms-excel.sheet.macroenabled.12", ".xlsm"},
+        {"application/vnd.panoply", ".plp"},
+        {"image/vnd.sealed.png", ".spng"},
+        {"application/vnd.groove-tool-template", ".tpl"},
+        {"image/jxr", ".jxr"},
+        {"application/vnd.imagemeter.folder+zip", ".imf"},
+        {"", ""},
+        {"application/atom+xml", ".atom"},
+        {"application/x-java-pack200", ".pack"},
+        {"video/sgi-movie", ".movie"},
+        {"application/vnd.bluetooth.ep.oob", ".ep"},
+        {"image/heif", ".heif"},
+        {"application/cdmi-container", ".cdmic"},
+        {"text/dns", ".zone"},
+        {"application/emma+xml", ".emma"},
+        {"audio/mod", ".mod"},
+        {"application/vnd.pg.format", ".str"},
+        {"application/vnd.anki", ".apkg"},
+        {"application/vnd.wap.sic", ".sic"},
+        {"application/vnd.etsi.timestamp-token", ".tst"},
+        {"application/vnd.sun.xml.math", ".sxm"},
+        {"application/vnd.mobius.plc", ".plc"},
+        {"application/csrattrs", ".csrattrs"},
+        {"audio/ms-wma", ".wma"},
+        {"application/atsc-held+xml", ".held"},
+        {"application/vnd.muvee.style", ".msty"},
+        {"text/vnd.in3d.3dml", ".3dml"},
+        {"audio/vnd.dece.audio", ".uvva"},
+        {"application/vnd.ms-3mfdocument", ".3mf"},
+        {"application/vnd.hdt", ".hdt"},
+        {"audio/annodex", ".axa"},
+        {"text/markdown; charset=utf-8", ".md"},
+        {"application/xliff+xml", ".xlf"},
+        {"application/vnd.mobius.mqy", ".mqy"},
+        {"application/vnd.businessobjects", ".rep"},
+        {"text/vnd.ascii-art", ".ascii"},
+        {"application/auth-policy+xml", ".apxml"},
+        {"model/vnd.moml+xml", ".moml"},
+        {"application/vnd.patentdive", ".dive"},
+        {"font/ttf", ".ttf"},
+        {"application/metalink4+xml", ".meta4"},
+        {"application/vnd.shade-save-file", ".ssv"},
+        {"", ""},
+        {"application/vnd.3gpp.pic-bw-large", ".plb"},
+        {"application/vnd.grafeq", ".gqs"},
+        {"text/calendar", ".ifb"},
+        {"text/cache-manifest", ".manifest"},
+        {"application/x-cpio", ".cpio"},
+        {"application/vnd.irepository.package+xml", ".irp"},
+        {"audio/usac", ".xhe"},
+        {"image/heic", ".heic"},
+        {"application/route-apd+xml", ".rapd"},
+        {"application/vnd.mfer", ".mwf"},
+        {"application/vnd.ficlab.flb+zip", ".flb"},
+        {"application/vnd.commerce-battelle", ".icf"},
+        {"audio/evrc", ".evc"},
+        {"model/vnd.usdz+zip", ".usdz"},
+        {"application/vnd.ms-fontobject", ".eot"},
+        {"application/vnd.flographit", ".gph"},
+        {"application/vnd.sun.wadl+xml", ".wadl"},
+        {"image/vnd.zbrush.pcx", ".pcx"},
+        {"application/vnd.dna", ".dna"},
+        {"application/vnd.insors.igm", ".igm"},
+        {"text/vnd.si.uricatalogue", ".uric"},
+        {"application/cea", ".cea"},
+        {"application/vnd.3m.post-it-notes", ".pwn"},
+        {"application/vnd.xmpie.dpkg", ".dpkg"},
+        {"audio/vnd.rip", ".rip"},
+        {"application/vnd.shx", ".shx"},
+        {"application/vnd.jisp", ".jisp"},
+        {"text/vnd.hgl", ".hgl"},
+        {"application/tamp-community-update", ".tcu"},
+        {"application/gzip", ".tgz"},
+        {"audio/ilbc", ".lbc"},
+        {"application/json-patch+json", ".json-patch"},
+        {"application/zip", ".zip"},
+        {"application/prs.cww", ".cww"},
+        {"application/vnd.webturbo", ".wtb"},
+        {"application/vnd.kde.kspread", ".ksp"},
+        {"text/vcard", ".vcf"},
+        {"application/vnd.collabio.xodocuments.spreadsheet", ".xods"},
+        {"application/vnd.maxmind.maxmind-db", ".mmdb"},
+        {"application/ccmp+xml", ".ccmp"},
+        {"application/vnd.mynfc", ".taglet"},
+        {"application/vnd.ms-cab-compressed", ".cab"},
+        {"application/vnd.vidsoft.vidconference", ".vsc"},
+        {"application/watcherinfo+xml", ".wif"},
+        {"application/sgml-open-catalog", ".soc"},
+        {"application/vnd.sealed.3df", ".s3df"},
+        {"image/jph", ".jph"},
+        {"application/vnd.cendio.thinlinc.clientconf", ".tlclient"},
+        {"text/turtle", ".ttl"},
+        {"application/vnd.dart", ".dart"},
+        {"audio/mp4", ".m4a"},
+        {"application/pdf", ".pdf"},
+        {"application/vnd.wolfram.mathematica.package", ".m"},
+        {"application/scvp-vp-request", ".spq"},
+        {"application/pkcs7-signature", ".p7s"},
+        {"video/mp4", ".mp4"},
+        {"image/vnd.dece.graphic", ".uvvi"},
+        {"application/tamp-error", ".ter"},
+        {"application/vnd.fujitsu.oasys3", ".oa3"},
+        {"video/ms-wmx", ".wmx"},
+        {"application/vnd.vd-study", ".study-inter"},
+        {"image/x-targa", ".tga"},
+        {"application/json", ".json"},
+        {"application/voicexml+xml", ".vxml"},
+        {"application/vnd.hp-pcl", ".pcl"},
+        {"application/vnd.sealedmedia.softseal.html", ".stml"},
+        {"application/vnd.wfa.p2p", ".p2p"},
+        {"application/vnd.openxmlformats-officedocument.wordprocessingml.template", ".dotx"},
+        {"application/x-tar", ".tar"},
+        {"application/vnd.kde.kformula", ".kfo"},
+        {"application/vnd.kahootz", ".ktz"},
+        {"application/senml+xml", ".senmlx"},
+        {"application/vnd.valve.source.material", ".vmt"},
+        {"audio/vnd.nortel.vbk", ".vbk"},
+        {"application/vnd.crick.clicker.keyboard", ".clkk"},
+        {"application/vnd.nokia.radio-preset", ".rpst"},
+        {"application/vnd.nokia.n-gage.data", ".ngdat"},
+        {"text/vnd.trolltech.linguist", ".ts"},
+        {"audio/ogg", ".ogg"},
+        {"application/x-netcdf", ".nc"},
+        {"model/vnd.opengex", ".ogex"},
+        {"application/vnd.espass-espass+zip", ".espass"},
+        {"application/n-quads", ".nq"},
+        {"application/vnd.font-fontforge-sfd", ".sfd"},
+        {"application/vnd.openeye.oeb", ".oeb"},
+        {"image/vnd.mozilla.apng", ".apng"},
+        {"font/woff", ".woff"},
+        {"image/svg+xml", ".svgz"},
+        {"application/vnd.wap.mms-message", ".mms"},
+        {"application/vnd.publishare-delta-tree", ".qps"},
+        {"image/tiff-fx", ".tfx"},
+        {"application/ipfix", ".ipfix"},
+        {"application/x-texinfo", ".texinfo"},
+        {"application/vnd.oasis.opendocument.text-web", ".oth"},
+        {"application/vnd.marlin.drm.mdcf", ".mdc"},
+        {"application/vnd.novadigm.edm", ".edm"},
+        {"application/vnd.etsi.asic-s+zip", ".asics"},
+        {"application/vnd.claymore", ".cla"},
+        {"image/jxsi", ".jxsi"},
+        {"application/vnd.llamagraphics.life-balance.exchange+xml", ".lbe"},
+        {"image/aces", ".exr"},
+        {"application/vnd.apple.installer+xml", ".pkg"},
+        {"application/vnd.sealed.xls", ".sxls"},
+        {"text/prs.lines.tag", ".tag"},
+        {"application/vnd.pawaafile", ".paw"},
+        {"image/vnd.xiff", ".xif"},
+        {"application/vnd.oasis.opendocument.presentation", ".odp"},
+        {"application/vnd.stepmania.package", ".smzip"},
+        {"application/vnd.spotfire.sfs", ".sfs"},
+        {"application/vnd.oma.drm.rights+wbxml", ".drc"},
+        {"application/vnd.kde.kivio", ".flw"},
+        {"application/vnd.palm", ".prc"},
+        {"text/html; charset=utf-8", ".html"},
+        {"video/vnd.dece.sd", ".uvvs"},
+        {"application/rdf+xml", ".rdf"},
+        {"text/vnd.ms-mediapackage", ".mpf"},
+        {"application/vnd.kde.kontour", ".kon"},
+        {"application/rpki-manifest", ".mft"},
+        {"application/vnd.rig.cryptonote", ".cryptonote"},
+        {"text/vnd.sosi", ".sos"},
+        {"application/vnd.hal+xml", ".hal"},
+        {"application/vnd.wap.wmlscriptc", ".wmlsc"},
+        {"application/resource-lists+xml", ".rl"},
+        {"text/troff", ".tr"},
+        {"application/dssc+der", ".dssc"},
+        {"model/gltf-binary", ".glb"},
+        {"application/dii", ".dii"},
+        {"application/rpki-roa", ".roa"},
+        {"image/vnd.sealedmedia.softseal.jpg", ".sjpg"},
+        {"", ""},
+        {"application/thraud+xml", ".tfi"},
+        {"application/mads+xml", ".mads"},
+        {"application/vnd.xmpie.xlim", ".xlim"},
+        {"application/pkix-crl", ".crl"},
+        {"application/vnd.fdf", ".fdf"},
+        {"application/pkcs8-encrypted", ".p8e"},
+        {"image/vnd.fujixerox.edmics-rlc", ".rlc"},
+        {"application/vnd.adobe.fxp", ".fxpl"},
+        {"text/tab-separated-values", ".tsv"},
+        {"model/stl", ".stl"},
+        {"application/vnd.exstream-empower+zip", ".mpw"},
+        {"application/vnd.crick.clicker.wordbank", ".clkw"},
+        {"application/lxf", ".lxf"},
+        {"application/vnd.commonspace", ".cst"},
+        {"application/vnd.software602.filler.form-xml-zip", ".zfo"},
+        {"application/dskpp+xml", ".xmls"},
+        {"application/x-csh", ".csh"},
+        {"application/vnd.wt.stf", ".stf"},
+        {"video/vnd.dece.hd", ".uvvh"},
+        {"video/flv", ".flv"},
+        {"image/tiff", ".tiff"},
+        {"application/vnd.oasis.opendocument.image-template", ".oti"},
+        {"audio/vnd.dts", ".dts"},
+        {"application/vnd.noblenet-sealer", ".nns"},
+        {"application/xcap-diff+xml", ".xdf"},
+        {"audio/32kadpcm", ".726"},
+        {"application/x-futuresplash", ".spl"},
+        {"application/x-java-jnlp-file", ".jnlp"},
+        {"application/vnd.ipunplugged.rcprofile", ".rcprofile"},
+        {"application/x-dvi", ".dvi"},
+        {"application/x-gtar", ".gtar"},
+        {"application/rfc+xml", ".rfcxml"},
+        {"application/vnd.pvi.ptid1", ".ptid"},
+        {"image/x-portable-bitmap", ".pbm"},
+        {"font/collection", ".ttc"},
+        {"text/vnd.a", ".a"},
+        {"model/iges", ".igs"},
+        {"application/vnd.handheld-entertainment+xml", ".zmm"},
+        {"model/gltf+json", ".gltf"},
+        {"audio/ms-wax", ".wax"},
+        {"audio/vnd.dolby.mlp", ".mlp"},
+        {"application/vnd.realvnc.bed", ".bed"},
+        {"application/vnd.quark.quarkxpress", ".qxt"},
+        {"application/vnd.comicbook+zip", ".cbz"},
+        {"", ""},
+        {"application/vnd.geometry-explorer", ".gre"},
+        {"application/srgs+xml", ".grxml"},
+        {"audio/basic", ".snd"},
+        {"image/x-cmu-raster", ".ras"},
+        {"application/vnd.powerbuilder6", ".pbd"},
+        {"application/vnd.crick.clicker.palette", ".clkp"},
+        {"application/x-sv4crc", ".sv4crc"},
+        {"audio/mpegurl", ".m3u"},
+        {"application/rls-services+xml", ".rs"},
+        {"application/vnd.hhe.lesson-player", ".les"},
+        {"image/vnd.radiance", ".xyze"},
+        {"audio/qcelp", ".qcp"},
+        {"application/voucher-cms+json", ".vcj"},
+        {"application/vnd.wfa.wsc", ".wsc"},
+        {"application/atsc-rsat+xml", ".rsat"},
+        {"application/vnd.smart.notebook", ".notebook"},
+        {"audio/vnd.lucent.voice", ".lvp"},
+        {"model/mesh", ".silo"},
+        {"image/jpeg", ".jpg"},
+        {"application/vnd.fujixerox.docuworks", ".xdw"},
+        {"application/vnd.sealed.mht", ".smht"},
+        {"application/vnd.semf", ".semf"},
+        {"application/vnd.blueice.multipass", ".mpm"},
+        {"application/vnd.musician", ".mus"},
+        {"application/pkix-cert", ".cer"},
+        {"application/timestamp-query", ".tsq"},
+        {"application/marcxml+xml", ".mrcx"},
+        {"application/vnd.dece.unspecified", ".uvx"},
+        {"application/vnd.psfs", ".psfs"},
+        {"application/vnd.cosmocaller", ".cmc"},
+        {"application/vnd.oasis.opendocument.spreadsheet-template", ".ots"},
+        {"application/x-sh", ".sh"},
+        {"application/vnd.dtg.local.flash", ".fla"},
+        {"application/xcap-att+xml", ".xav"},
+        {"", ""},
+        {"video/ms-wmv", ".wmv"},
+        {"application/vnd.novadigm.edx", ".edx"},
+        {"application/vnd.dzr", ".dzr"},
+        {"application/vnd.mobius.daf", ".daf"},
+        {"application/atsc-dwd+xml", ".dwd"},
+        {"application/vnd.chess-pgn", ".pgn"},
+        {"application/vnd.dynageo", ".geo"},
+        {"application/vnd.ms-officetheme", ".thmx"},
+        {"application/vnd.epson.ssf", ".ssf"},
+        {"application/vnd.ms-excel.template.macroenabled.12", ".xltm"},
+        {"application/vnd.crick.clicker", ".clkx"},
+        {"application/vnd.oxli.countgraph", ".oxlicg"},
+        {"application/pkcs7-mime", ".p7m"},
+        {"application/sensml-exi", ".sensmle"},
+        {"", ""},
+        {"application/vnd.fujitsu.oasysgp", ".fg5"},
+        {"application/vnd.fdsn.mseed", ".mseed"},
+        {"application/vnd.fujitsu.oasys", ".oas"},
+        {"application/marc", ".mrc"},
+        {"application/x-troff-man", ".man"},
+        {"application/vnd.oma.drm.dcf", ".o4v"},
+        {"application/x-java-archive", ".jar"},
+        {"application/x-bittorrent", ".torrent"},
+        {"model/vnd.dwf", ".dwf"},
+        {"application/vnd.ezpix-album", ".ez2"},
+        {"application/vnd.onepager", ".tam"},
+        {"application/vnd.dece.data", ".uvvf"},
+        {"application/vnd.geoplan", ".g2w"},
+        {"multipart/voice-message", ".vpm"},
+        {"application/vnd.ms-lrm", ".lrm"},
+        {"audio/amr", ".amr"},
+        {"application/xcap-el+xml", ".xel"},
+        {"application/vnd.pg.osasli", ".ei6"},
+        {"image/dicom-rle", ".drle"},
+        {"application/senml-etch+cbor", ".senml-etchc"},
+        {"application/vnd.sealed.ppt", ".sppt"},
+        {"application/vnd.coreos.ignition+json", ".ignition"},
+        {"application/vnd.syncml.dmddf+xml", ".ddf"},
+        {"application/prs.nprend", ".rnd"},
+        {"application/vnd.simtech-mindmapper", ".twds"},
+        {"application/vnd.sealed.tiff", ".stif"},
+        {"application/vnd.crypto-shade-file", ".ssvc"},
+        {"application/bacnet-xdd+zip", ".xdd"},
+        {"application/vnd.anser-web-funds-transfer-initiation", ".fti"},
+        {"", ""},
+        {"application/vnd.oma.drm.rights+xml", ".dr"},
+        {"application/vnd.lotus-organizer", ".org"},
+        {"application/vnd.veryant.thin", ".isws"},
+        {"application/vnd.syncml+xml", ".xsm"},
+        {"application/vnd.accpac.simply.imp", ".imp"},
+        {"application/vnd.apple.numbers", ".numbers"},
+        {"video/javafx", ".fxm"},
+        {"application/vnd.visio", ".vsw"},
+        {"audio/mobile-xmf", ".mxmf"},
+        {"application/tamp-apex-update", ".tau"},
+        {"application/vnd.sun.xml.calc.template", ".stc"},
+        {"audio/mhas", ".mhas"},
+        {"text/vnd.esmertec.theme-descriptor", ".jtd"},
+        {"application/urc-grpsheet+xml", ".gsheet"},
+        {"application/vnd.collabio.xodocuments.document-template", ".xott"},
+        {"text/prs.fallenstein.rst", ".rst"},
+        {"image/x-xpixmap", ".xpm"},
+        {"", ""},
+        {"application/vnd.openxmlformats-officedocument.presentationml.slide", ".sldx"},
+        {"image/ktx", ".ktx"},
+        {"application/reginfo+xml", ".rif"},
+        {"application/mbox", ".mbox"},
+        {"message/rfc822", ".mail"},
+        {"application/its+xml", ".its"},
+        {"application/vnd.artisan+json", ".artisan"},
+        {"application/vnd.xmpie.cpkg", ".cpkg"},
+        {"font/otf", ".otf"},
+        {"application/davmount+xml", ".davmount"},
+        {"image/avci", ".avci"},
+        {"application/rtf", ".rtf"},
+        {"text/vnd.abc", ".abc"},
+        {"application/vnd.ms-htmlhelp", ".chm"},
+        {"application/vnd.ms-powerpoint.slideshow.macroenabled.12", ".ppsm"},
+        {"application/vnd.oasis.opendocument.presentation-template", ".otp"},
+        {"video/iso.segment", ".m4s"},
+        {"application/vnd.doremir.scorecloud-binary-document", ".scld"},
+        {"application/vnd.nintendo.nitro.rom", ".nds"},
+        {"application/vnd.mophun.certificate", ".mpc"},
+        {"text/vtt", ".vtt"},
+        {"application/vnd.kenameaapp", ".htke"},
+        {"application/vnd.cloanto.rp9", ".rp9"},
+        {"application/x-sv4cpio", ".sv4cpio"},
+        {"application/vnd.symbian.install", ".sis"},
+        {"text/uri-list", ".uris"},
+        {"application/vnd.sun.xml.calc", ".sxc"},
+        {"application/oebps-package+xml", ".opf"},
+        {"model/vnd.gtw", ".gtw"},
+        {"application/vnd.intergeo", ".i2g"},
+        {"font/woff2", ".woff2"},
+        {"application/aml", ".aml"},
+        {"application/vnd.mobius.msl", ".msl"},
+        {"application/vnd.las.las+xml", ".lasxml"},
+        {"application/vnd.dreamfactory", ".dfac"},
+        {"application/vnd.evolv.ecig.theme", ".ecigtheme"},
+        {"application/vnd.ufdl", ".ufdl"},
+        {"application/vnd.hp-hpid", ".hpid"},
+        {"text/vnd.fmi.flexstor", ".flx"},
+        {"application/vnd.pocketlearn", ".plf"},
+        {"model/vnd.vtu", ".vtu"},
+        {"application/vnd.preminet", ".preminet"},
+        {"application/vnd.ms-excel", ".xlw"},
+        {"text/plain; charset=utf-8", ".txt"},
+        {"video/mpeg", ".mpg"},
+        {"application/efi", ".efi"},
+        {"application/vnd.bluetooth.le.oob", ".le"},
+        {"application/xop+xml", ".xop"},
+        {"application/vnd.tml", ".viaframe"},
+        {"image/webp", ".webp"},
+        {"application/vnd.mobius.txf", ".txf"},
+        {"application/vnd.ms-powerpoint.slide.macroenabled.12", ".sldm"},
+        {"application/ccxml+xml", ".ccxml"},
+        {"application/vnd.hp-hps", ".hps"},
+        {"audio/vnd.nuera.ecelp9600", ".ecelp9600"},
+        {"", ""},
+        {"application/vnd.dbf", ".dbf"},
+        {"image/gif", ".gif"},
+        {"application/urc-targetdesc+xml", ".td"},
+        {"application/mmt-usd+xml", ".musd"},
+        {"application/vnd.mapbox-vector-tile", ".mvt"},
+        {"application/vnd.hbci", ".upa"},
+        {"application/mmt-aei+xml", ".maei"},
+        {"application/inkml+xml", ".inkml"},
+        {"application/vnd.ves.encrypted", ".VES"},
+        {"application/vnd.stepmania.stepchart", ".sm"},
+        {"application/atomsvc+xml", ".atomsvc"},
+        {"application/x-killustrator", ".kil"},
+        {"application/vnd.epson.quickanime", ".qam"},
+        {"application/vnd.openblox.game+xml", ".obgx"},
+        {"application/vnd.sailingtracker.track", ".st"},
+        {"image/emf", ".emf"},
+        {"video/vnd.nokia.interleaved-multimedia", ".nim"},
+        {"text/vnd.wap.sl", ".sl"},
+        {"application/vnd.apple.keynote", ".keynote"},
+        {"application/vnd.osgeo.mapguide.package", ".mgp"},
+        {"application/gml+xml", ".gml"},
+        {"application/mac-compactpro", ".cpt"},
+        {"application/mathml+xml", ".mml"},
+        {"application/oxps", ".oxps"},
+        {"application/vnd.collabio.xodocuments.presentation", ".xodp"},
+        {"audio/evrcb", ".evb"},
+        {"application/vnd.curl", ".curl"},
+        {"model/vnd.collada+xml", ".dae"},
+        {"text/vnd.dmclientscript", ".dms"},
+        {"application/vnd.sun.xml.draw", ".sxd"},
+        {"application/vnd.ms-xpsdocument", ".xps"},
+        {"application/dcd", ".dcd"},
+        {"application/vnd.fdsn.seed", ".seed"},
+        {"text/vnd.net2phone.commcenter.command", ".ccc"},
+        {"application/vnd.shp", ".shp"},
+        {"application/vnd.oma.dd2+xml", ".dd2"},
+        {"application/vnd.hp-jlyt", ".jlt"},
+        {"application/vnd.dvb.service", ".svc"},
+        {"application/vnd.groove-identity-message", ".gim"},
+        {"application/vnd.ahead.space", ".ahead"},
+        {"application/vnd.groove-injector", ".grv"},
+        {"application/vnd.msa-disk-image", ".msa"},
+        {"application/vnd.sun.xml.draw.template", ".std"},
+        {"application/vnd.koan", ".skt"},
+        {"application/vnd.yamaha.openscoreformat", ".osf"},
+        {"application/vnd.fastcopy-disk-image", ".dim"},
+        {"application/vnd.afpc.modca", ".pseg3820"},
+        {"application/cdfx+xml", ".cdfx"},
+        {"application/vnd.sus-calendar", ".susp"},
+        {"video/vnd.mpegurl", ".mxu"},
+        {"application/vnd.groove-account", ".gac"},
+        {"application/atf", ".atf"},
+        {"image/jxs", ".jxs"},
+        {"application/vnd.astraea-software.iota", ".iota"},
+        {"image/jxra", ".jxra"},
+        {"video/vnd.youtube.yt", ".yt"},
+        {"application/vnd.loom", ".loom"},
+        {"image/vnd.sealedmedia.softseal.gif", ".sgif"},
+        {"application/x-hdf", ".hdf"},
+        {"video/vnd.dvb.file", ".dvb"},
+        {"application/senml+cbor", ".senmlc"},
+        {"application/vnd.lotus-freelance", ".prz"},
+        {"application/vnd.coffeescript", ".coffee"},
+        {"application/vnd.sema", ".sema"},
+        {"application/vnd.chemdraw+xml", ".cdxml"},
+        {"application/vnd.olpc-sugar", ".xo"},
+        {"application/x-chrome-extension", ".crx"},
+        {"application/vnd.fujitsu.oasys2", ".oa2"},
+        {"application/pem-certificate-chain", ".pem"},
+        {"application/vnd.openxmlformats-officedocument.presentationml.presentation", ".pptx"},
+        {"application/vnd.sigrok.session", ".sr"},
+        {"video/ogg", ".ogv"},
+        {"application/tamp-update-confirm", ".tuc"},
+        {"application/vnd.etsi.asic-e+zip", ".sce"},
+        {"image/vnd.fpx", ".fpx"},
+        {"application/cdmi-domain", ".cdmid"},
+        {"application/urc-ressheet+xml", ".rsheet"},
+        {"application/vnd.geogebra.file", ".ggb"},
+        {"application/td+json", ".jsontd"},
+        {"application/vnd.adobe.formscentral.fcdt", ".fcdt"},
+        {"application/vnd.android.package-archive", ".apk"},
+        {"model/mtl", ".mtl"},
+        {"application/vnd.oasis.opendocument.text-template", ".ott"},
+        {"application/vnd.imagemeter.image+zip", ".imi"},
+        {"application/x-shar", ".shar"},
+        {"image/vnd.fujixerox.edmics-mmr", ".mmr"},
+        {"model/vnd.mts", ".mts"},
+        {"application/vnd.scribus", ".slaz"},
+        {"application/vnd.oma.drm.message", ".dm"},
+        {"application/vnd.apple.mpegurl", ".m3u8"},
+        {"application/vnd.oasis.opendocument.chart-template", ".otc"},
+        {"application/vnd.pmi.widget", ".wg"},
+        {"application/dssc+xml", ".xdssc"},
+        {"application/vnd.kde.kword", ".kwt"},
+        {"application/vnd.oasis.opendocument.graphics-template", ".otg"},
+        {"image/hsj2", ".hsj2"},
+        {"text/x-setext", ".etx"},
+        {"video/vnd.sealed.swf", ".sswf"},
+        {"application/vnd.ms-powerpoint.addin.macroenabled.12", ".ppam"},
+        {"application/atfx", ".atfx"},
+        {"application/vnd.sealedmedia.softseal.pdf", ".spdf"},
+        {"image/vnd.tencent.tap", ".tap"},
+        {"application/stix+json", ".stix"},
+        {"application/vnd.dvb.ait", ".ait"},
+        {"application/lpf+zip", ".lpf"},
+        {"application/vnd.oasis.opendocument.database", ".odb"},
+        {"application/vnd.ms-artgalry", ".cil"},
+        {"application/scvp-cv-request", ".scq"},
+        {"application/vnd.dpgraph", ".mwc"},
+        {"application/dit", ".dit"},
+        {"application/vnd.zul", ".zirz"},
+        {"application/fastinfoset", ".finf"},
+        {"audio/ac3", ".ac3"},
+        {"application/vnd.acucobol", ".acu"},
+        {"audio/aac", ".aac"},
+        {"application/sensml+cbor", ".sensmlc"},
+        {"chemical/x-xyz", ".xyz"},
+        {"image/vnd.adobe.photoshop", ".psd"},
+        {"application/vnd.adobe.xdp+xml", ".xdp"},
+        {"text/vnd.fly", ".fly"},
+        {"application/relax-ng-compact-syntax", ".rnc"},
+        {"audio/pn-realaudio", ".rm"},
+        {"application/vnd.balsamiq.bmml+xml", ".bmml"},
+        {"application/x-xz", ".xz"},
+        {"application/a2l", ".a2l"},
+        {"application/vnd.route66.link66+xml", ".link66"},
+        {"application/dash+xml", ".mpd"},
+        {"video/webm", ".webm"},
+        {"application/vnd.bmi", ".bmi"},
+        {"application/vnd.noblenet-directory", ".nnd"},
+        {"application/vnd.ms-wpl", ".wpl"},
+        {"x-conference/x-cooltalk", ".ice"},
+        {"application/vnd.afpc.modca-pagesegment", ".psg"},
+        {"application/vnd.oasis.opendocument.image", ".odi"},
+        {"text/jcr-cnd", ".cnd"},
+        {"application/p2p-overlay+xml", ".relo"},
+        {"application/vnd.openofficeorg.extension", ".oxt"},
+        {"application/vnd.desmume.movie", ".dsm"},
+        {"application/vnd.adobe.xfdf", ".xfdf"},
+        {"image/fits", ".fts"},
+        {"application/vnd.epson.salt", ".slt"},
+        {"application/vnd.kinar", ".sdf"},
+        {"image/vnd.wap.wbmp", ".wbmp"},
+        {"", ""},
+        {"audio/prs.sid", ".sid"},
+        {"text/n3", ".n3"},
+        {"application/vnd.nintendo.snes.rom", ".smc"},
+        {"text/x-makefile; charset=utf-8", "Makefile"},
+        {"application/vnd.ms-excel.addin.macroenabled.12", ".xlam"},
+        {"application/vnd.android.ota", ".ota"},
+        {"application/route-usd+xml", ".rusd"},
+        {"application/vnd.gmx", ".gmx"},
+        {"image/prs.pti", ".pti"},
+        {"application/resource-lists-diff+xml", ".rld"},
+        {"application/tamp-update", ".tur"},
+        {"application/vnd.ibm.minipay", ".mpy"},
+        {"application/vnd.mcd", ".mcd"},
+        {"application/vnd.document+json", ".docjson"},
+        {"application/urc-uisocketdesc+xml", ".uis"},
+        {"application/vnd.ms-word.template.macroenabled.12", ".dotm"},
+        {"application/x-bcpio", ".bcpio"},
+        {"application/vnd.sqlite3", ".sqlite3"},
+        {"application/vnd.tmobile-livetv", ".tmo"},
+        {"application/vnd.mophun.application", ".mpn"},
+        {"application/ssml+xml", ".ssml"},
+        {"application/vnd.syncml.dm+wbxml", ".bdm"},
+        {"application/vnd.epson.msf", ".msf"},
+        {"application/dvcs", ".dvc"},
+        {"application/vnd.ms-word.document.macroenabled.12", ".docm"},
+        {"application/vnd.shana.informed.formdata", ".ifm"},
+        {"application/vnd.yamaha.hv-dic", ".hvd"},
+        {"application/mxf", ".mxf"},
+        {"application/lgr+xml", ".lgr"},
+        {"application/vnd.fujixerox.docuworks.binder", ".xbd"},
+        {"image/vnd.fastbidsheet", ".fbs"},
+        {"application/vnd.jcp.javame.midlet-rms", ".rms"},
+        {"image/vnd.dwg", ".dwg"},
+        {"image/avcs", ".avcs"},
+        {"application/vnd.proteus.magazine", ".mgz"},
+        {"audio/s3m", ".s3m"},
+        {"application/vnd.cups-ppd", ".ppd"},
+        {"video/vnd.vivo", ".viv"},
+        {"application/vnd.hp-hpgl", ".hpgl"},
+        {"application/mathematica", ".nb"},
+        {"video/vnd.dece.mp4", ".uvvu"},
+        {"application/vnd.apple.pages", ".pages"},
+        {"application/cellml+xml", ".cml"},
+        {"application/x-troff-me", ".me"},
+        {"model/x3d-vrml", ".x3dvz"},
+        {"application/gltf-buffer", ".glbuf"},
+        {"", ""},
+        {"application/rpki-ghostbusters", ".gbr"},
+        {"application/vnd.lotus-approach", ".vew"},
+        {"image/vnd.microsoft.icon", ".ico"},
+        {"application/x-tex", ".tex"},
+        {"application/vnd.nitf", ".nitf"},
+        {"model/obj", ".obj"},
+        {"video/vnd.dece.mobile", ".uvvm"},
+        {"application/vnd.fsc.weblaunch", ".fsc"},
+        {"application/vnd.ibm.rights-management", ".irm"},
+        {"text/xml", ".xml"},
+        {"application/vnd.uoml+xml", ".uoml"},
+        {"application/vnd.ms-powerpoint", ".ppt"},
+        {"application/ttml+xml", ".ttml"},
+        {"application/vnd.shana.informed.formtemplate", ".itp"},
+        {"application/x-ustar", ".ustar"},
+        {"application/vnd.openxmlformats-officedocument.presentationml.slideshow", ".ppsx"},
+        {"application/vnd.openstreetmap.data+xml", ".osm"},
+        {"audio/asc", ".acn"},
+        {"application/mods+xml", ".mods"},
+        {"application/vnd.ibm.secure-container", ".sc"},
+        {"application/wsdl+xml", ".wsdl"},
+        {"application/vnd.wmc", ".wmc"},
+        {"application/prs.rdf-xml-crypt", ".rdf-crypt"},
+        {"application/vnd.oasis.opendocument.chart", ".odc"},
+        {"audio/realaudio", ".ra"},
+        {"x-epoc/x-sisx-app", ".sisx"},
+        {"application/vnd.neurolanguage.nlu", ".nlu"},
+        {"application/vnd.openxmlformats-officedocument.wordprocessingml.document", ".docx"},
+        {"audio/mpeg", ".mp3"},
+        {"application/vnd.enliven", ".nml"},
+        {"", ""},
+        {"application/vnd.autopackage", ".package"},
+        {"application/cms", ".cmsc"},
+        {"application/vnd.oasis.opendocument.spreadsheet", ".ods"},
+        {"application/vnd.sun.xml.impress.template", ".sti"},
+        {"image/hej2k", ".hej2"},
+        {"image/heic-sequence", ".heics"},
+        {"audio/vnd.ms-playready.media.pya", ".pya"},
+        {"application/vnd.wv.csp+wbxml", ".wv"},
+        {"application/xcap-caps+xml", ".xca"},
+        {"image/wmf", ".wmf"},
+        {"text/vnd.sun.j2me.app-descriptor", ".jad"},
+        {"application/vnd.vsf", ".vsf"},
+        {"application/vnd.amazon.mobi8-ebook", ".azw3"},
+        {"application/vnd.fuzzysheet", ".fzs"},
+        {"application/x-latex", ".latex"},
+        {"video/vnd.dece.video", ".uvvv"},
+        {"application/wspolicy+xml", ".wspolicy"},
+        {"application/sru+xml", ".sru"},
+        {"application/vnd.seemail", ".see"},
+        {"application/vnd.micrografx.flo", ".flo"},
+        {"audio/atrac-x", ".atx"},
+        {"application/atomdeleted+xml", ".atomdeleted"},
+        {"application/vnd.smart.teacher", ".teacher"},
+        {"image/x-portable-graymap", ".pgm"},
+        {"application/tamp-sequence-adjust", ".tsa"},
+        {"application/vnd.ibm.electronic-media", ".emm"},
+        {"application/vnd.medcalcdata", ".mc1"},
+        {"audio/vnd.everad.plj", ".plj"},
+        {"image/jphc", ".jhc"},
+        {"application/xv+xml", ".xvml"},
+        {"application/vnd.software602.filler.form+xml", ".fo"},
+        {"application/lostsync+xml", ".lostsyncxml"},
+        {"", ""},
+        {"audio/atrac3", ".omg"},
+        {"application/vnd.openxmlformats-officedocument.spreadsheetml.template", ".xltx"},
+        {"application/vnd.epson.esf", ".esf"},
+        {"text/sgml", ".sgml"},
+        {"application/vnd.geospace", ".g3w"},
+        {"audio/amr-wb", ".awb"},
+        {"application/vnd.dece.zip", ".uvz"},
+        {"application/vnd.frogans.ltf", ".ltf"},
+        {"application/tei+xml", ".teicorpus"},
+        {"audio/smv", ".smv"},
+        {"application/vnd.genomatix.tuxedo", ".txd"},
+        {"application/prs.hpub+zip", ".hpub"},
+        {"image/cgm", ".cgm"},
+        {"application/trig", ".trig"},
+        {"application/pdx", ".pdx"},
+        {"application/vnd.snesdev-page-table", ".ptrom"},
+        {"image/vnd.dxf", ".dxf"},
+        {"application/vnd.triscape.mxs", ".mxs"},
+        {"application/vnd.hzn-3d-crossword", ".x3d"},
+        {"application/vnd.fujitsu.oasysprs", ".bh2"},
+        {"application/vnd.openblox.game-binary", ".obg"},
+        {"application/vnd.think-cell.ppttc+json", ".ppttc"},
+        {"application/vnd.mobius.dis", ".dis"},
+        {"application/vnd.novadigm.ext", ".ext"},
+        {"application/vnd.filmit.zfc", ".zfc"},
+        {"application/atxml", ".atxml"},
+        {"application/vnd.hydrostatix.sof-data", ".sfd-hdstx"},
+        {"application/vnd.chipnuts.karaoke-mmd", ".mmd"},
+        {"application/vnd.lotus-screencam", ".scm"},
+        {"application/vnd.kde.kchart", ".chrt"},
+        {"application/vnd.ms-powerpoint.presentation.macroenabled.12", ".pptm"},
+        {"audio/evrcwb", ".evw"},
+        {"application/vnd.nokia.n-gage.symbian.install", ".n-gage"},
+        {"application/vnd.intu.qbo", ".qbo"},
+        {"image/heif-sequence", ".heifs"},
+        {"application/vnd.yamaha.hv-script", ".hvs"},
+        {"text/csv; charset=utf-8", ".csv"},
+        {"application/vnd.ms-tnef", ".tnf"},
+        {"application/vnd.mediastation.cdkey", ".cdkey"},
+        {"application/mac-binhex40", ".hqx"},
+        {"audio/vnd.audikoz", ".koz"},
+        {"application/vnd.3gpp2.tcap", ".tcap"},
+        {"application/x-stuffit", ".sit"},
+        {"application/vnd.oasis.opendocument.graphics", ".odg"},
+        {"application/tamp-community-update-confirm", ".cuc"},
+        {"application/vnd.mfmp", ".mfm"},
+        {"application/vnd.sun.xml.impress", ".sxi"},
+        {"application/vnd.airzip.filesecure.azs", ".azs"},
+        {"text/vnd.wap.si", ".si"},
+        {"application/vnd.1000minds.decision-model+xml", ".1km"},
+        {"application/vnd.anser-web-certificate-issue-initiation", ".cii"},
+        {"application/vnd.picsel", ".efif"},
+        {"application/vnd.yaoweme", ".yme"},
+        {"application/vnd.yamaha.hv-voice", ".hvp"},
+        {"application/vnd.oasis.opendocument.text-master", ".odm"},
+        {"application/vnd.amiga.ami", ".ami"},
+        {"application/vnd.geogebra.tool", ".ggt"},
+        {"application/vnd.groove-tool-message", ".gtm"},
+        {"application/postscript", ".ps"},
+        {"application/vnd.onepagertamp", ".tamp"},
+        {"text/vnd.wap.wml", ".wml"},
+        {"audio/stm", ".stm"},
+        {"application/vnd.tao.intent-module-archive", ".tao"},
+        {"application/vnd.nervana", ".request"},
+        {"application/vnd.collabio.xodocuments.document", ".xodt"},
+        {"", ""},
+        {"application/vnd.3lightssoftware.imagescal", ".imgcal"},
+        {"application/smil+xml", ".sml"},
+        {"application/timestamped-data", ".tsd"},
+        {"application/metalink+xml", ".metalink"},
+        {"image/jpx", ".jpx"},
+        {"application/senml-exi", ".senmle"},
+    };
+
+    inline constexpr uint16_t ext_seeds[] = {
+        12, 4, 6, 2, 20, 11, 24, 94, 1, 28, 6, 4,
+        7, 1, 31, 77, 7, 220, 2, 5, 12, 3, 61, 4,
+        46, 62, 275, 24, 3, 0, 28, 4, 7, 46, 27, 5,
+        11, 15, 1, 3, 1, 53, 83, 195, 24, 13, 16, 51,
+        5, 3, 7, 5, 8, 36, 2, 3, 77, 52, 61, 4,
+        2, 5, 109, 7, 10, 227, 82, 18, 12, 4, 150, 1,
+        76, 2, 14, 8, 10, 2, 1, 63, 65, 2, 24, 25,
+        2, 1, 16, 17, 14, 59, 14, 3, 7, 136, 0, 22,
+        2, 188, 1, 12, 35, 3, 47, 13, 2, 91, 42, 4,
+        26, 2, 15, 27, 26, 44, 106, 60, 28, 197, 91, 171,
+        151, 6, 1, 106, 17, 18, 7, 9, 34, 31, 74, 0,
+        13, 13, 1, 270, 8, 217, 313, 167, 8, 52, 29, 3,
+        7, 29, 281, 14, 2, 34, 28, 236, 3, 78, 24, 45,
+        96, 114, 1, 104, 1, 11, 102, 27, 71, 136, 51, 9,
+        42, 18, 57, 482, 22, 7, 8, 3, 12, 3, 14, 20,
+        196, 117, 254, 83, 26, 19, 179, 9, 292, 13, 99, 1,
+        160, 168, 40, 187, 24, 2, 142, 662, 86, 14, 272, 574,
+        23, 15, 44, 4, 30, 174, 2, 231, 148, 375, 18, 2,
+        29, 83, 9, 71, 44, 17, 76, 118, 17, 2, 9, 63,
+        503, 108, 9, 8, 450, 172, 0, 43, 219, 80, 1102, 44,
+        5, 21, 444, 192, 2, 71, 535, 72, 2, 296, 310, 52,
+        1377, 15, 496, 326,
+    };
+
+    inline constexpr entry ext_slots[] = {
+        {".heics", "image/heic-sequence"},
+        {".pem", "application/pem-certificate-chain"},
+        {".mcd", "application/vnd.mcd"},
+        {".m4a", "audio/mp4"},
+        {"", ""},
+        {".artisan", "application/vnd.artisan+json"},
+        {".rcprofile", "application/vnd.ipunplugged.rcprofile"},
+        {".wmls", "text/vnd.wap.wmlscript"},
+        {".osm", "application/vnd.openstreetmap.data+xml"},
+        {".fm", "application/vnd.framemaker"},
+        {".joda", "application/vnd.joost.joda-archive"},
+        {".lvp", "audio/vnd.lucent.voice"},
+        {".n-gage", "application/vnd.nokia.n-gage.symbian.install"},
+        {".ts", "text/vnd.trolltech.linguist"},
+        {".u8dsn", "message/global-delivery-status"},
+        {".nb", "application/mathematica"},
+        {".wsdl", "application/wsdl+xml"},
+        {".ep", "application/vnd.bluetooth.ep.oob"},
+        {".tamp", "application/vnd.onepagertamp"},
+        {".xltx", "application/vnd.openxmlformats-officedocument.spreadsheetml.template"},
+        {".aiff", "audio/aiff"},
+        {".snd", "audio/basic"},
+        {".rnd", "application/prs.nprend"},
+        {".mvt", "application/vnd.mapbox-vector-tile"},
+        {".dotx", "application/vnd.openxmlformats-officedocument.wordprocessingml.template"},
+        {".mpg", "video/mpeg"},
+        {".rnc", "application/relax-ng-compact-syntax"},
+        {"", ""},
+        {".ez2", "application/vnd.ezpix-album"},
+        {".odb", "application/vnd.oasis.opendocument.database"},
+        {".pvb", "application/vnd.3gpp.pic-bw-var"},
+        {".src", "application/x-wais-source"},
+        {".pkg", "application/vnd.apple.installer+xml"},
+        {".me", "application/x-troff-me"},
+        {".fxm", "video/javafx"},
+        {".dae", "model/vnd.collada+xml"},
+        {".sxc", "application/vnd.sun.xml.calc"},
+        {".mf4", "application/mf4"},
+        {".acu", "application/vnd.acucobol"},
+        {".ief", "image/ief"},
+        {".svgz", "image/svg+xml"},
+        {".xdp", "application/vnd.adobe.xdp+xml"},
+        {".psfs", "application/vnd.psfs"},
+        {".jar", "application/x-java-archive"},
+        {".xdf", "application/xcap-diff+xml"},
+        {".xdd", "application/bacnet-xdd+zip"},
+        {".cmc", "application/vnd.cosmocaller"},
+        {".unityweb", "application/vnd.unity"},
+        {".hgl", "text/vnd.hgl"},
+        {".ppttc", "application/vnd.think-cell.ppttc+json"},
+        {".jnlp", "application/x-java-jnlp-file"},
+        {".dive", "application/vnd.patentdive"},
+        {".zone", "text/dns"},
+        {".bz2", "application/x-bzip2"},
+        {".nq", "application/n-quads"},
+        {".vis", "application/vnd.visionary"},
+        {".nml", "application/vnd.enliven"},
+        {".hqx", "application/mac-binhex40"},
+        {".tra", "application/vnd.trueapp"},
+        {".fsc", "application/vnd.fsc.weblaunch"},
+        {".cdkey", "application/vnd.mediastation.cdkey"},
+        {".jlt", "application/vnd.hp-jlyt"},
+        {".bmml", "application/vnd.balsamiq.bmml+xml"},
+        {".oas", "application/vnd.fujitsu.oasys"},
+        {".les", "application/vnd.hhe.lesson-player"},
+        {".anx", "application/x-annodex"},
+        {".ppam", "application/vnd.ms-powerpoint.addin.macroenabled.12"},
+        {".latex", "application/x-latex"},
+        {".sandboxed", "text/html-sandboxed"},
+        {".txd", "application/vnd.genomatix.tuxedo"},
+        {".ami", "application/vnd.amiga.ami"},
+        {".ddf", "application/vnd.syncml.dmddf+xml"},
+        {".keynote", "application/vnd.apple.keynote"},
+        {".swidtag", "application/swid+xml"},
+        {".dcd", "application/dcd"},
+        {".obg", "application/vnd.openblox.game-binary"},
+        {".apng", "image/vnd.mozilla.apng"},
+        {".sldm", "application/vnd.ms-powerpoint.slide.macroenabled.12"},
+        {".karbon", "application/vnd.kde.karbon"},
+        {".vcd", "application/x-cdlink"},
+        {".torrent", "application/x-bittorrent"},
+        {".sse", "application/vnd.kodak-descriptor"},
+        {"", ""},
+        {".coffee", "application/vnd.coffeescript"},
+        {".senmlx", "application/senml+xml"},
+        {".awb", "audio/amr-wb"},
+        {".csl", "application/vnd.citationstyles.style+xml"},
+        {".kwt", "application/vnd.kde.kword"},
+        {".senmlc", "application/senml+cbor"},
+        {".mrcx", "application/marcxml+xml"},
+        {".mpn", "application/vnd.mophun.application"},
+        {".rar", "application/vnd.rar"},
+        {".gac", "application/vnd.groove-account"},
+        {".fg5", "application/vnd.fujitsu.oasysgp"},
+        {".rusd", "application/route-usd+xml"},
+        {".xodp", "application/vnd.collabio.xodocuments.presentation"},
+        {".jsonld", "application/ld+json"},
+        {".smpg", "video/vnd.sealed.mpeg1"},
+        {".mwc", "application/vnd.dpgraph"},
+        {".js", "application/javascript"},
+        {".cdmic", "application/cdmi-container"},
+        {".rld", "application/resource-lists-diff+xml"},
+        {".oda", "application/oda"},
+        {".obj", "model/obj"},
+        {".xlsb", "application/vnd.ms-excel.sheet.binary.macroenabled.12"},
+        {".jls", "image/jls"},
+        {".woff2", "font/woff2"},
+        {".smp3", "audio/vnd.sealedmedia.softseal.mpeg"},
+        {".p2p", "application/vnd.wfa.p2p"},
+        {".tsv", "text/tab-separated-values"},
+        {".flo", "application/vnd.micrografx.flo"},
+        {".xsm", "application/vnd.syncml+xml"},
+        {".sensmlc", "application/sensml+cbor"},
+        {".uvvp", "video/vnd.dece.pd"},
+        {".package", "application/vnd.autopackage"},
+        {".xlsx", "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
+        {".sls", "application/route-s-tsid+xml"},
+        {".hal", "application/vnd.hal+xml"},
+        {".msl", "application/vnd.mobius.msl"},
+        {".pcx", "image/vnd.zbrush.pcx"},
+        {".dwg", "image/vnd.dwg"},
+        {".bar", "application/vnd.qualcomm.brew-app-res"},
+        {".daf", "application/vnd.mobius.daf"},
+        {".tga", "image/x-targa"},
+        {".drc", "application/vnd.oma.drm.rights+wbxml"},
+        {".u8mdn", "message/global-disposition-notification"},
+        {".wax", "audio/ms-wax"},
+        {".ext", "application/vnd.novadigm.ext"},
+        {".xns", "application/xcap-ns+xml"},
+        {".flac", "audio/flac"},
+        {".pil", "application/vnd.piaccess.application-license"},
+        {"", ""},
+        {".dna", "application/vnd.dna"},
+        {".glbuf", "application/gltf-buffer"},
+        {".sos", "text/vnd.sosi"},
+        {".bin", "application/octet-stream"},
+        {".ifb", "text/calendar"},
+        {".gph", "application/vnd.flographit"},
+        {".scsf", "application/vnd.sealed.csf"},
+        {".hdt", "application/vnd.hdt"},
+        {".zst", "application/zstd"},
+        {".uoml", "application/vnd.uoml+xml"},
+        {".xop", "application/xop+xml"},
+        {".plp", "application/vnd.panoply"},
+        {".sfd", "application/vnd.font-fontforge-sfd"},
+        {"", ""},
+        {".sml", "application/smil+xml"},
+        {".azs", "application/vnd.airzip.filesecure.azs"},
+        {".cst", "application/vnd.commonspace"},
+        {".c3ex", "application/cccex"},
+        {".kia", "application/vnd.kidspiration"},
+        {".jisp", "application/vnd.jisp"},
+        {".wml", "text/vnd.wap.wml"},
+        {".wmlc", "application/vnd.wap.wmlc"},
+        {".sig", "application/pgp-signature"},
+        {".sdf", "application/vnd.kinar"},
+        {".manifest", "text/cache-manifest"},
+        {".mxmf", "audio/mobile-xmf"},
+        {".flt", "text/vnd.ficlab.flt"},
+        {".ovl", "application/vnd.afpc.modca-overlay"},
+        {".fdt", "application/fdt+xml"},
+        {".provx", "application/provenance+xml"},
+        {".cmsc", "application/cms"},
+        {".fcs", "application/vnd.isac.fcs"},
+        {".nimn", "application/vnd.nimn"},
+        {".siv", "application/sieve"},
+        {".cl", "application/simple-filter+xml"},
+        {".tsq", "application/timestamp-query"},
+        {".mpdd", "application/dashdelta"},
+        {".ggt", "application/vnd.geogebra.tool"},
+        {".oxlicg", "application/vnd.oxli.countgraph"},
+        {".xlim", "application/vnd.xmpie.xlim"},
+        {".m3u8", "application/vnd.apple.mpegurl"},
+        {".ecelp7470", "audio/vnd.nuera.ecelp7470"},
+        {".json", "application/json"},
+        {".mail", "message/rfc822"},
+        {".c4u", "application/vnd.clonk.c4group"},
+        {".hvp", "application/vnd.yamaha.hv-voice"},
+        {".wqd", "application/vnd.wqd"},
+        {".fo", "application/vnd.software602.filler.form+xml"},
+        {".ac3", "audio/ac3"},
+        {".rdf-crypt", "application/prs.rdf-xml-crypt"},
+        {".portpkg", "application/vnd.macports.portpkg"},
+        {".texinfo", "application/x-texinfo"},
+        {".ott", "application/vnd.oasis.opendocument.text-template"},
+        {".yang", "application/yang"},
+        {".sisx", "x-epoc/x-sisx-app"},
+        {".uric", "text/vnd.si.uricatalogue"},
+        {".tsd", "application/timestamped-data"},
+        {".hps", "application/vnd.hp-hps"},
+        {".provn", "text/provenance-notation"},
+        {".rgb", "image/x-rgb"},
+        {".cpl", "application/cpl+xml"},
+        {".mpy", "application/vnd.ibm.minipay"},
+        {".x3db", "model/x3d+xml"},
+        {".tcu", "application/tamp-community-update"},
+        {".rpst", "application/vnd.nokia.radio-preset"},
+        {".xyz", "chemical/x-xyz"},
+        {".djvu", "image/vnd.djvu"},
+        {".xcs", "application/calendar+xml"},
+        {".exr", "image/aces"},
+        {".ait", "application/vnd.dvb.ait"},
+        {".oxps", "application/oxps"},
+        {".upa", "application/vnd.hbci"},
+        {".stk", "application/hyperstudio"},
+        {".axv", "video/annodex"},
+        {".ssv", "application/vnd.shade-save-file"},
+        {".bcpio", "application/x-bcpio"},
+        {".wma", "audio/ms-wma"},
+        {".teicorpus", "application/tei+xml"},
+        {".ivp", "application/vnd.immervision-ivp"},
+        {".scs", "application/scvp-cv-response"},
+        {".pml", "application/vnd.ctc-posml"},
+        {".sdoc", "application/vnd.sealed.doc"},
+        {".fxpl", "application/vnd.adobe.fxp"},
+        {".woff", "font/woff"},
+        {".slaz", "application/vnd.scribus"},
+        {".3gpp2", "video/3gpp2"},
+        {".sxi", "application/vnd.sun.xml.impress"},
+        {".pkipath", "application/pkix-pkipath"},
+        {".wav", "audio/wav"},
+        {".tnf", "application/vnd.ms-tnef"},
+        {".nt", "application/n-triples"},
+        {".pya", "audio/vnd.ms-playready.media.pya"},
+        {".wg", "application/vnd.pmi.widget"},
+        {".copyright", "text/vnd.debian.copyright"},
+        {".xps", "application/vnd.ms-xpsdocument"},
+        {".fnc", "application/vnd.frogans.fnc"},
+        {".otg", "application/vnd.oasis.opendocument.graphics-template"},
+        {".eot", "application/vnd.ms-fontobject"},
+        {".hsj2", "image/hsj2"},
+        {".flb", "application/vnd.ficlab.flb+zip"},
+        {".ccxml", "application/ccxml+xml"},
+        {".uvx", "application/vnd.dece.unspecified"},
+        {".aml", "application/aml"},
+        {".jxs", "image/jxs"},
+        {".nns", "application/vnd.noblenet-sealer"},
+        {".stif", "application/vnd.sealed.tiff"},
+        {".3mf", "application/vnd.ms-3mfdocument"},
+        {".msty", "application/vnd.muvee.style"},
+        {".ecig", "application/vnd.evolv.ecig.settings"},
+        {".webp", "image/webp"},
+        {".pfr", "application/font-tdpfr"},
+        {".m3u", "audio/mpegurl"},
+        {".igs", "model/iges"},
+        {".sms", "application/vnd.3gpp2.sms"},
+        {".fts", "image/fits"},
+        {".vbox", "application/vnd.previewsystems.box"},
+        {".726", "audio/32kadpcm"},
+        {".cdbcmsg", "application/vnd.contact.cmsg"},
+        {".dp", "application/vnd.osgi.dp"},
+        {".swi", "application/vnd.aristanetworks.swi"},
+        {".qcall", "application/vnd.ericsson.quickcall"},
+        {".pages", "application/vnd.apple.pages"},
+        {".VES", "application/vnd.ves.encrypted"},
+        {".lrm", "application/vnd.ms-lrm"},
+        {".fdf", "application/vnd.fdf"},
+        {".mxs", "application/vnd.triscape.mxs"},
+        {".sxls", "application/vnd.sealed.xls"},
+        {".l16", "audio/l16"},
+        {".vtu", "model/vnd.vtu"},
+        {".clkt", "application/vnd.crick.clicker.template"},
+        {".bk2", "video/vnd.radgamettools.bink"},
+        {".sis", "application/vnd.symbian.install"},
+        {".pls", "application/pls+xml"},
+        {".hej2", "image/hej2k"},
+        {".ppsx", "application/vnd.openxmlformats-officedocument.presentationml.slideshow"},
+        {".tmo", "application/vnd.tmobile-livetv"},
+        {".clkp", "application/vnd.crick.clicker.palette"},
+        {".jpg2", "image/jp2"},
+        {".xhtml", "application/xhtml+xml"},
+        {".spq", "application/scvp-vp-request"},
+        {".rip", "audio/vnd.rip"},
+        {".apk", "application/vnd.android.package-archive"},
+        {".ustar", "application/x-ustar"},
+        {".x3d", "application/vnd.hzn-3d-crossword"},
+        {".odp", "application/vnd.oasis.opendocument.presentation"},
+        {".ufdl", "application/vnd.ufdl"},
+        {".avi", "video/msvideo"},
+        {".preminet", "application/vnd.preminet"},
+        {".itp", "application/vnd.shana.informed.formtemplate"},
+        {".azw3", "application/vnd.amazon.mobi8-ebook"},
+        {".rl", "application/resource-lists+xml"},
+        {".wlnk", "application/link-format"},
+        {".smov", "video/vnd.sealedmedia.softseal.mov"},
+        {".hpub", "application/prs.hpub+zip"},
+        {".musd", "application/mmt-usd+xml"},
+        {".qxt", "application/vnd.quark.quarkxpress"},
+        {".mc2", "text/vnd.senx.warpscript"},
+        {".cpio", "application/x-cpio"},
+        {".tap", "image/vnd.tencent.tap"},
+        {".odf", "application/vnd.oasis.opendocument.formula"},
+        {".ac", "application/vnd.nokia.n-gage.ac+xml"},
+        {".td", "application/urc-targetdesc+xml"},
+        {".multitrack", "audio/vnd.presonus.multitrack"},
+        {".man", "application/x-troff-man"},
+        {".pub", "application/vnd.exstream-package"},
+        {".cdfx", "application/cdfx+xml"},
+        {".lasxml", "application/vnd.las.las+xml"},
+        {".cla", "application/vnd.claymore"},
+        {".u8hdr", "message/global-headers"},
+        {"", ""},
+        {".nlu", "application/vnd.neurolanguage.nlu"},
+        {"", ""},
+        {".xif", "image/vnd.xiff"},
+        {".atc", "application/vnd.acucorp"},
+        {".jpg", "image/jpeg"},
+        {".png", "image/png"},
+        {".gbr", "application/rpki-ghostbusters"},
+        {".ggb", "application/vnd.geogebra.file"},
+        {".sjpg", "image/vnd.sealedmedia.softseal.jpg"},
+        {".iota", "application/vnd.astraea-software.iota"},
+        {".ivu", "application/vnd.immervision-ivu"},
+        {"Makefile", "text/x-makefile; charset=utf-8"},
+        {".sc", "application/vnd.ibm.secure-container"},
+        {".ndc", "application/vnd.osa.netdeploy"},
+        {".pgb", "image/vnd.globalgraphics.pgb"},
+        {".gtm", "application/vnd.groove-tool-message"},
+        {".teacher", "application/vnd.smart.teacher"},
+        {".mxl", "application/vnd.recordare.musicxml"},
+        {".flw", "application/vnd.kde.kivio"},
+        {".zfc", "application/vnd.filmit.zfc"},
+        {".clkw", "application/vnd.crick.clicker.wordbank"},
+        {".dit", "application/dit"},
+        {".tex", "application/x-tex"},
+        {".dvb", "video/vnd.dvb.file"},
+        {".mbox", "application/mbox"},
+        {".ecelp4800", "audio/vnd.nuera.ecelp4800"},
+        {".gxt", "application/vnd.geonext"},
+        {".qt", "video/quicktime"},
+        {".mtl", "model/mtl"},
+        {".ssvc", "application/vnd.crypto-shade-file"},
+        {".s3df", "application/vnd.sealed.3df"},
+        {".mqy", "application/vnd.mobius.mqy"},
+        {".cpt", "application/mac-compactpro"},
+        {".sub", "text/vnd.dvb.subtitle"},
+        {".rapd", "application/route-apd+xml"},
+        {".es", "application/ecmascript"},
+        {".meta4", "application/metalink4+xml"},
+        {".ms", "application/x-troff-ms"},
+        {".odm", "application/vnd.oasis.opendocument.text-master"},
+        {".ttf", "font/ttf"},
+        {".ignition", "application/vnd.coreos.ignition+json"},
+        {".kpt", "application/vnd.kde.kpresenter"},
+        {".azf", "application/vnd.airzip.filesecure.azf"},
+        {".sv4cpio", "application/x-sv4cpio"},
+        {".ccmp", "application/ccmp+xml"},
+        {".sdkm", "application/vnd.solent.sdkm+xml"},
+        {".oa2", "application/vnd.fujitsu.oasys2"},
+        {".cdmio", "application/cdmi-object"},
+        {".atomcat", "application/atomcat+xml"},
+        {".mml", "application/mathml+xml"},
+        {".dcm", "application/dicom"},
+        {".p10", "application/pkcs10"},
+        {".ogv", "video/ogg"},
+        {".vmt", "application/vnd.valve.source.material"},
+        {".apxml", "application/auth-policy+xml"},
+        {".jrd", "application/jrd+json"},
+        {".loom", "application/vnd.loom"},
+        {".wrl", "model/vrml"},
+        {".mods", "application/mods+xml"},
+        {".iif", "application/vnd.shana.informed.interchange"},
+        {".qcp", "audio/qcelp"},
+        {".emf", "image/emf"},
+        {".icf", "application/vnd.commerce-battelle"},
+        {".crx", "application/x-chrome-extension"},
+        {".oxt", "application/vnd.openofficeorg.extension"},
+        {".shp", "application/vnd.shp"},
+        {".psd", "image/vnd.adobe.photoshop"},
+        {".so", "application/octet-stream"},
+        {".xotp", "application/vnd.collabio.xodocuments.presentation-template"},
+        {".kon", "application/vnd.kde.kontour"},
+        {".koz", "audio/vnd.audikoz"},
+        {".gram", "application/srgs"},
+        {"", ""},
+        {".senml-etchc", "application/senml-etch+cbor"},
+        {".kml", "application/vnd.google-earth.kml+xml"},
+        {".jpx", "image/jpx"},
+        {".gpkg", "application/geopackage+sqlite3"},
+        {".dim", "application/vnd.fastcopy-disk-image"},
+        {".mpw", "application/vnd.exstream-empower+zip"},
+        {".gim", "application/vnd.groove-identity-message"},
+        {".cer", "application/pkix-cert"},
+        {".opf", "application/oebps-package+xml"},
+        {".vpm", "multipart/voice-message"},
+        {".held", "application/atsc-held+xml"},
+        {".ppd", "application/vnd.cups-ppd"},
+        {".gre", "application/vnd.geometry-explorer"},
+        {".sensmle", "application/sensml-exi"},
+        {".qfx", "application/vnd.intu.qfx"},
+        {".rif", "application/reginfo+xml"},
+        {".sdp", "application/sdp"},
+        {".hvs", "application/vnd.yamaha.hv-script"},
+        {".metalink", "application/metalink+xml"},
+        {".mets", "application/mets+xml"},
+        {".zirz", "application/vnd.zul"},
+        {".heifs", "image/heif-sequence"},
+        {".mms", "application/vnd.wap.mms-message"},
+        {".ecelp9600", "audio/vnd.nuera.ecelp9600"},
+        {".espass", "application/vnd.espass-espass+zip"},
+        {".bed", "application/vnd.realvnc.bed"},
+        {".oa3", "application/vnd.fujitsu.oasys3"},
+        {".pgn", "application/vnd.chess-pgn"},
+        {".odx", "application/odx"},
+        {".smht", "application/vnd.sealed.mht"},
+        {".sema", "application/vnd.sema"},
+        {".ghf", "application/vnd.groove-help"},
+        {".gml", "application/gml+xml"},
+        {".ent", "text/xml-external-parsed-entity"},
+        {".spp", "application/scvp-vp-response"},
+        {".ei6", "application/vnd.pg.osasli"},
+        {".dd", "application/vnd.oma.dd+xml"},
+        {"", ""},
+        {".ptid", "application/vnd.pvi.ptid1"},
+        {".tsa", "application/tamp-sequence-adjust"},
+        {".lasjson", "application/vnd.las.las+json"},
+        {".plc", "application/vnd.mobius.plc"},
+        {".apkg", "application/vnd.anki"},
+        {".asics", "application/vnd.etsi.asic-s+zip"},
+        {".odc", "application/vnd.oasis.opendocument.chart"},
+        {".owx", "application/owl+xml"},
+        {".rlc", "image/vnd.fujixerox.edmics-rlc"},
+        {".pki", "application/pkixcmp"},
+        {".mpd", "application/dash+xml"},
+        {".viaframe", "application/vnd.tml"},
+        {".pptx", "application/vnd.openxmlformats-officedocument.presentationml.presentation"},
+        {".smzip", "application/vnd.stepmania.package"},
+        {".gsheet", "application/urc-grpsheet+xml"},
+        {".spl", "application/x-futuresplash"},
+        {".ots", "application/vnd.oasis.opendocument.spreadsheet-template"},
+        {".nim", "video/vnd.nokia.interleaved-multimedia"},
+        {".org", "application/vnd.lotus-organizer"},
+        {".dssc", "application/dssc+der"},
+        {".3dml", "text/vnd.in3d.3dml"},
+        {".le", "application/vnd.bluetooth.le.oob"},
+        {".wbs", "application/vnd.criticaltools.wbs+xml"},
+        {".pptm", "application/vnd.ms-powerpoint.presentation.macroenabled.12"},
+        {".seml", "application/vnd.sealed.eml"},
+        {".glb", "model/gltf-binary"},
+        {".skt", "application/vnd.koan"},
+        {".senmle", "application/senml-exi"},
+        {".xlsm", "application/vnd.ms-excel.sheet.macroenabled.12"},
+        {".igm", "application/vnd.insors.igm"},
+        {".ez3", "application/vnd.ezpix-package"},
+        {".sql", "application/sql"},
+        {".plj", "audio/vnd.everad.plj"},
+        {".g2w", "application/vnd.geoplan"},
+        {".cww", "application/prs.cww"},
+        {".sti", "application/vnd.sun.xml.impress.template"},
+        {".acn", "audio/asc"},
+        {".bdm", "application/vnd.syncml.dm+wbxml"},
+        {".nds", "application/vnd.nintendo.nitro.rom"},
+        {".SAR", "application/vnd.sar"},
+        {".xvml", "application/xv+xml"},
+        {".ogg", "audio/ogg"},
+        {".bmi", "application/vnd.bmi"},
+        {".n3", "text/n3"},
+        {".hvd", "application/vnd.yamaha.hv-dic"},
+        {".irm", "application/vnd.ibm.rights-management"},
+        {".mp21", "application/mp21"},
+        {".sit", "application/x-stuffit"},
+        {".uvvu", "video/vnd.dece.mp4"},
+        {".mpm", "application/vnd.blueice.multipass"},
+        {".wps", "application/vnd.ms-works"},
+        {"", ""},
+        {".stf", "application/vnd.wt.stf"},
+        {".tau", "application/tamp-apex-update"},
+        {".mts", "model/vnd.mts"},
+        {".trig", "application/trig"},
+        {".xodt", "application/vnd.collabio.xodocuments.document"},
+        {"", ""},
+        {".win", "model/vnd.gdl"},
+        {"", ""},
+        {".vcg", "application/vnd.groove-vcard"},
+        {".gtar", "application/x-gtar"},
+        {".obgx", "application/vnd.openblox.game+xml"},
+        {".mp3", "audio/mpeg"},
+        {".ifm", "application/vnd.shana.informed.formdata"},
+        {".ccc", "text/vnd.net2phone.commcenter.command"},
+        {".st", "application/vnd.sailingtracker.track"},
+        {".msf", "application/vnd.epson.msf"},
+        {".pti", "image/prs.pti"},
+        {".vsw", "application/vnd.visio"},
+        {".tatx", "application/vnd.onepagertatx"},
+        {".cdmia", "application/cdmi-capability"},
+        {".c11amc", "application/vnd.cluetrust.cartomobile-config"},
+        {".lpf", "application/lpf+zip"},
+        {".i2g", "application/vnd.intergeo"},
+        {".nc", "application/x-netcdf"},
+        {".prz", "application/vnd.lotus-freelance"},
+        {".qam", "application/vnd.epson.quickanime"},
+        {".xbm", "image/x-xbitmap"},
+        {".sru", "application/sru+xml"},
+        {".notebook", "application/vnd.smart.notebook"},
+        {".ptrom", "application/vnd.snesdev-page-table"},
+        {".smc", "application/vnd.nintendo.snes.rom"},
+        {".1km", "application/vnd.1000minds.decision-model+xml"},
+        {".tatp", "application/vnd.onepagertatp"},
+        {".mwf", "application/vnd.mfer"},
+        {".ascii", "text/vnd.ascii-art"},
+        {".wvx", "video/ms-wvx"},
+        {".curl", "application/vnd.curl"},
+        {".wm", "video/ms-wm"},
+        {".asx", "video/ms-asf"},
+        {".mmdb", "application/vnd.maxmind.maxmind-db"},
+        {"", ""},
+        {".tfi", "application/thraud+xml"},
+        {".atxml", "application/atxml"},
+        {".xsf", "application/prs.xsf+xml"},
+        {".geo", "application/vnd.dynageo"},
+        {".flv", "video/flv"},
+        {".mp4", "video/mp4"},
+        {".atf", "application/atf"},
+        {".movie", "video/sgi-movie"},
+        {".docm", "application/vnd.ms-word.document.macroenabled.12"},
+        {".lcs", "application/vnd.logipipe.circuit+zip"},
+        {".yin", "application/yin+xml"},
+        {".sfs", "application/vnd.spotfire.sfs"},
+        {".xslt", "application/xslt+xml"},
+        {".isws", "application/vnd.veryant.thin"},
+        {".ntf", "application/vnd.lotus-notes"},
+        {".exi", "application/exi"},
+        {".wv", "application/vnd.wv.csp+wbxml"},
+        {".dib", "image/bmp"},
+        {".spf", "application/vnd.yamaha.smaf-phrase"},
+        {".wsc", "application/vnd.wfa.wsc"},
+        {".sensmlx", "application/sensml+xml"},
+        {".ktz", "application/vnd.kahootz"},
+        {".sldx", "application/vnd.openxmlformats-officedocument.presentationml.slide"},
+        {".etx", "text/x-setext"},
+        {".cab", "application/vnd.ms-cab-compressed"},
+        {".mlp", "audio/vnd.dolby.mlp"},
+        {".gltf", "model/gltf+json"},
+        {".ico", "image/vnd.microsoft.icon"},
+        {".mus", "application/vnd.musician"},
+        {".1905.1", "application/vnd.ieee.1905"},
+        {".tar", "application/x-tar"},
+        {".ras", "image/x-cmu-raster"},
+        {".dtshd", "audio/vnd.dts.hd"},
+        {".odt", "application/vnd.oasis.opendocument.text"},
+        {".ogx", "application/ogg"},
+        {".chm", "application/vnd.ms-htmlhelp"},
+        {".txt", "text/plain; charset=utf-8"},
+        {".sh", "application/x-sh"},
+        {".pcap", "application/vnd.tcpdump.pcap"},
+        {".wbxml", "application/vnd.wap.wbxml"},
+        {".jhc", "image/jphc"},
+        {".hdf", "application/x-hdf"},
+        {".atfx", "application/atfx"},
+        {".acc", "application/vnd.americandynamics.acc"},
+        {".irp", "application/vnd.irepository.package+xml"},
+        {".uvvi", "image/vnd.dece.graphic"},
+        {".tlclient", "application/vnd.cendio.thinlinc.clientconf"},
+        {".ecigtheme", "application/vnd.evolv.ecig.theme"},
+        {".xav", "application/xcap-att+xml"},
+        {".tsr", "application/timestamp-reply"},
+        {".rss", "application/rss+xml"},
+        {".sxm", "application/vnd.sun.xml.math"},
+        {".tam", "application/vnd.onepager"},
+        {".emm", "application/vnd.ibm.electronic-media"},
+        {".wtb", "application/vnd.webturbo"},
+        {".dts", "audio/vnd.dts"},
+        {".xul", "application/vnd.mozilla.xul+xml"},
+        {".fzs", "application/vnd.fuzzysheet"},
+        {".flx", "text/vnd.fmi.flexstor"},
+        {".lostxml", "application/lost+xml"},
+        {".mod", "audio/mod"},
+        {".kfo", "application/vnd.kde.kformula"},
+        {".lbe", "application/vnd.llamagraphics.life-balance.exchange+xml"},
+        {".scm", "application/vnd.lotus-screencam"},
+        {".esf", "application/vnd.epson.esf"},
+        {".cdy", "application/vnd.cinderella"},
+        {".dms", "text/vnd.dmclientscript"},
+        {".gmx", "application/vnd.gmx"},
+        {".saf", "application/vnd.yamaha.smaf-audio"},
+        {".doc", "application/msword"},
+        {".rep", "application/vnd.businessobjects"},
+        {".dfac", "application/vnd.dreamfactory"},
+        {".mgp", "application/vnd.osgeo.mapguide.package"},
+        {".edm", "application/vnd.novadigm.edm"},
+        {".imscc", "application/vnd.ims.imsccv1p1"},
+        {".xlam", "application/vnd.ms-excel.addin.macroenabled.12"},
+        {".wmx", "video/ms-wmx"},
+        {".rtx", "text/richtext"},
+        {".uvz", "application/vnd.dece.zip"},
+        {".xwd", "image/x-xwindowdump"},
+        {".potx", "application/vnd.openxmlformats-officedocument.presentationml.template"},
+        {".fst", "image/vnd.fst"},
+        {".mkv", "video/matroska"},
+        {".rpm", "application/x-rpm"},
+        {".vcx", "application/vnd.vcx"},
+        {".efif", "application/vnd.picsel"},
+        {".bmpr", "application/vnd.balsamiq.bmpr"},
+        {".sgif", "image/vnd.sealedmedia.softseal.gif"},
+        {".dxr", "application/x-director"},
+        {".x3dvz", "model/x3d-vrml"},
+        {".psg", "application/vnd.afpc.modca-pagesegment"},
+        {".dpkg", "application/vnd.xmpie.dpkg"},
+        {".lostsyncxml", "application/lostsync+xml"},
+        {".dcf", "application/vnd.oma.drm.content"},
+        {".spot", "text/vnd.in3d.spot"},
+        {".sfd-hdstx", "application/vnd.hydrostatix.sof-data"},
+        {".ac2", "application/vnd.banana-accounting"},
+        {".tag", "text/prs.lines.tag"},
+        {"", ""},
+        {".pbd", "application/vnd.powerbuilder6"},
+        {".rdz", "application/vnd.data-vision.rdz"},
+        {".dwf", "model/vnd.dwf"},
+        {".mrc", "application/marc"},
+        {"", ""},
+        {".sswf", "video/vnd.sealed.swf"},
+        {".xz", "application/x-xz"},
+        {".ppkg", "application/vnd.xmpie.ppkg"},
+        {".xpr", "application/vnd.is-xpr"},
+        {".o4v", "application/vnd.oma.drm.dcf"},
+        {".ims", "application/vnd.ms-ims"},
+        {".imf", "application/vnd.imagemeter.folder+zip"},
+        {".wmlsc", "application/vnd.wap.wmlscriptc"},
+        {".xlw", "application/vnd.ms-excel"},
+        {".umj", "application/vnd.umajin"},
+        {".midi", "audio/midi"},
+        {".mc1", "application/vnd.medcalcdata"},
+        {".xyze", "image/vnd.radiance"},
+        {".dxf", "image/vnd.dxf"},
+        {".cml", "application/cellml+xml"},
+        {".fpx", "image/vnd.fpx"},
+        {".xpi", "application/x-xpinstall"},
+        {".xo", "application/vnd.olpc-sugar"},
+        {".emma", "application/emma+xml"},
+        {".uvvt", "application/vnd.dece.ttml+xml"},
+        {".eol", "audio/vnd.digital-winds"},
+        {".quox", "application/vnd.quobject-quoxdocument"},
+        {".pskcxml", "application/pskc+xml"},
+        {".tr", "text/troff"},
+        {".edx", "application/vnd.novadigm.edx"},
+        {".svc", "application/vnd.dvb.service"},
+        {".sxw", "application/vnd.sun.xml.writer"},
+        {".cdmiq", "application/cdmi-queue"},
+        {".jxss", "image/jxss"},
+        {".see", "application/vnd.seemail"},
+        {".sppt", "application/vnd.sealed.ppt"},
+        {".wmc", "application/vnd.wmc"},
+        {".request", "application/vnd.nervana"},
+        {".zaz", "application/vnd.zzazz.deck+xml"},
+        {".gif", "image/gif"},
+        {".mseed", "application/vnd.fdsn.mseed"},
+        {".swf", "application/vnd.adobe.flash.movie"},
+        {".md", "text/markdown; charset=utf-8"},
+        {".oti", "application/vnd.oasis.opendocument.image-template"},
+        {".crtr", "application/vnd.multiad.creator"},
+        {".jpm", "image/jpm"},
+        {".tat", "application/vnd.onepagertat"},
+        {".aso", "application/vnd.accpac.simply.aso"},
+        {".numbers", "application/vnd.apple.numbers"},
+        {".slt", "application/vnd.epson.salt"},
+        {".tamx", "application/vnd.onepagertamx"},
+        {".dr", "application/vnd.oma.drm.rights+xml"},
+        {".3gpp", "video/3gpp"},
+        {".pwn", "application/vnd.3m.post-it-notes"},
+        {".xel", "application/xcap-el+xml"},
+        {".aep", "application/vnd.audiograph"},
+        {".ksp", "application/vnd.kde.kspread"},
+        {".mxf", "application/mxf"},
+        {".rfcxml", "application/rfc+xml"},
+        {".gv", "text/vnd.graphviz"},
+        {".ngdat", "application/vnd.nokia.n-gage.data"},
+        {".vwx", "application/vnd.vectorworks"},
+        {".gtw", "model/vnd.gtw"},
+        {".srx", "application/sparql-results+xml"},
+        {".mmd", "application/vnd.chipnuts.karaoke-mmd"},
+        {".rst", "text/prs.fallenstein.rst"},
+        {".vtt", "text/vtt"},
+        {".aac", "audio/aac"},
+        {".qvd", "application/vnd.theqvd"},
+        {".pl", "application/x-perl"},
+        {".cmp", "application/vnd.yellowriver-custom-menu"},
+        {".cpkg", "application/vnd.xmpie.cpkg"},
+        {".esa", "application/vnd.osgi.subsystem"},
+        {".stw", "application/vnd.sun.xml.writer.template"},
+        {".psb", "application/vnd.3gpp.pic-bw-small"},
+        {".tao", "application/vnd.tao.intent-module-archive"},
+        {".lgr", "application/lgr+xml"},
+        {".pnm", "image/x-portable-anymap"},
+        {".ttml", "application/ttml+xml"},
+        {".c11amz", "application/vnd.cluetrust.cartomobile-config-pkg"},
+        {".jxrs", "image/jxrs"},
+        {".mseq", "application/vnd.mseq"},
+        {".vcf", "text/vcard"},
+        {"", ""},
+        {".pod", "text/x-pod"},
+        {".spdf", "application/vnd.sealedmedia.softseal.pdf"},
+        {".stml", "application/vnd.sealedmedia.softseal.html"},
+        {".uris", "text/uri-list"},
+        {".pgp", "application/pgp-encrypted"},
+        {".msa", "application/vnd.msa-disk-image"},
+        {".ez", "application/andrew-inset"},
+        {".btif", "image/prs.btif"},
+        {".dvi", "application/x-dvi"},
+        {".igx", "application/vnd.micrografx.igx"},
+        {".rs", "application/rls-services+xml"},
+        {".wgt", "application/widget"},
+        {".davmount", "application/davmount+xml"},
+        {".imp", "application/vnd.accpac.simply.imp"},
+        {"", ""},
+        {".enw", "audio/evrcnw"},
+        {".ota", "application/vnd.android.ota"},
+        {".ra", "audio/realaudio"},
+        {".mhas", "audio/mhas"},
+        {".viv", "video/vnd.vivo"},
+        {".otf", "font/otf"},
+        {".p7s", "application/pkcs7-signature"},
+        {".vtf", "image/vnd.valve.source.texture"},
+        {".mif", "application/vnd.mif"},
+        {".csv", "text/csv; charset=utf-8"},
+        {".omg", "audio/atrac3"},
+        {".docx", "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+        {".evw", "audio/evrcwb"},
+        {".wpd", "application/vnd.wordperfect"},
+        {".txf", "application/vnd.mobius.txf"},
+        {".jsontd", "application/td+json"},
+        {".soc", "application/sgml-open-catalog"},
+        {".uvvf", "application/vnd.dece.data"},
+        {".otc", "application/vnd.oasis.opendocument.chart-template"},
+        {".roa", "application/rpki-roa"},
+        {".ppt", "application/vnd.ms-powerpoint"},
+        {".mka", "audio/matroska"},
+        {".cnd", "text/jcr-cnd"},
+        {".lbc", "audio/ilbc"},
+        {".html", "text/html"},
+        {".mjp2", "video/mj2"},
+        {".nbp", "application/vnd.wolfram.player"},
+        {".gqs", "application/vnd.grafeq"},
+        {".ltf", "application/vnd.frogans.ltf"},
+        {".uvvs", "video/vnd.dece.sd"},
+        {".its", "application/its+xml"},
+        {".cil", "application/vnd.ms-artgalry"},
+        {".xfdl", "application/vnd.xfdl"},
+        {".rsat", "application/atsc-rsat+xml"},
+        {".s3m", "audio/s3m"},
+        {".si", "text/vnd.wap.si"},
+        {".slc", "application/vnd.wap.slc"},
+        {".thmx", "application/vnd.ms-officetheme"},
+        {".qbo", "application/vnd.intu.qbo"},
+        {".axa", "audio/annodex"},
+        {".cgm", "image/cgm"},
+        {".chrt", "application/vnd.kde.kchart"},
+        {".mdc", "application/vnd.marlin.drm.mdcf"},
+        {".lxf", "application/lxf"},
+        {".ttl", "text/turtle"},
+        {".mag", "application/vnd.ecowin.chart"},
+        {".yme", "application/vnd.yaoweme"},
+        {".dd2", "application/vnd.oma.dd2+xml"},
+        {".sensml", "application/sensml+json"},
+        {".sic", "application/vnd.wap.sic"},
+        {".u8msg", "message/global"},
+        {".vsf", "application/vnd.vsf"},
+        {".utz", "application/vnd.uiq.theme"},
+        {".sqlite3", "application/vnd.sqlite3"},
+        {".otp", "application/vnd.oasis.opendocument.presentation-template"},
+        {".css", "text/css; charset=utf-8"},
+        {".jam", "application/vnd.jam"},
+        {".tpl", "application/vnd.groove-tool-template"},
+        {".wpl", "application/vnd.ms-wpl"},
+        {".stc", "application/vnd.sun.xml.calc.template"},
+        {".xct", "application/vnd.fujixerox.docuworks.container"},
+        {".potm", "application/vnd.ms-powerpoint.template.macroenabled.12"},
+        {".uvvv", "video/vnd.dece.video"},
+        {".m", "application/vnd.wolfram.mathematica.package"},
+        {".yt", "video/vnd.youtube.yt"},
+        {".kmz", "application/vnd.google-earth.kmz"},
+        {".ppm", "image/x-portable-pixmap"},
+        {".hpid", "application/vnd.hp-hpid"},
+        {".bh2", "application/vnd.fujitsu.oasysprs"},
+        {".g3w", "application/vnd.geospace"},
+        {".uis", "application/urc-uisocketdesc+xml"},
+        {".fbs", "image/vnd.fastbidsheet"},
+        {".sv4crc", "application/x-sv4crc"},
+        {".avci", "image/avci"},
+        {".rq", "application/sparql-query"},
+        {".grxml", "application/srgs+xml"},
+        {".uvvh", "video/vnd.dece.hd"},
+        {".s14", "video/vnd.sealed.mpeg4"},
+        {".shar", "application/x-shar"},
+        {".zmm", "application/vnd.handheld-entertainment+xml"},
+        {".sxg", "application/vnd.sun.xml.writer.global"},
+        {"", ""},
+        {".xmls", "application/dskpp+xml"},
+        {".lbd", "application/vnd.llamagraphics.life-balance.desktop"},
+        {".study-inter", "application/vnd.vd-study"},
+        {".shf", "application/shf+xml"},
+        {".p8e", "application/pkcs8-encrypted"},
+        {".ipk", "application/vnd.shana.informed.package"},
+        {".mdi", "image/vnd.ms-modi"},
+        {".asf", "application/vnd.ms-asf"},
+        {".odi", "application/vnd.oasis.opendocument.image"},
+        {".dvc", "application/dvcs"},
+        {".atx", "audio/atrac-x"},
+        {".dii", "application/dii"},
+        {".xspf", "application/x-xspf+xml"},
+        {".wbmp", "image/vnd.wap.wbmp"},
+        {".fti", "application/vnd.anser-web-funds-transfer-initiation"},
+        {".jxsi", "image/jxsi"},
+        {".abc", "text/vnd.abc"},
+        {".xfdf", "application/vnd.adobe.xfdf"},
+        {".ter", "application/tamp-error"},
+        {".ssml", "application/ssml+xml"},
+        {".tcl", "application/x-tcl"},
+        {".moml", "model/vnd.moml+xml"},
+        {"", ""},
+        {".imi", "application/vnd.imagemeter.image+zip"},
+        {".ssf", "application/vnd.epson.ssf"},
+        {".imgcal", "application/vnd.3lightssoftware.imagescal"},
+        {".dls", "audio/dls"},
+        {".ors", "application/ocsp-response"},
+        {".tfx", "image/tiff-fx"},
+        {".cbor", "application/cbor"},
+        {".tcap", "application/vnd.3gpp2.tcap"},
+        {".miz", "text/mizar"},
+        {".udeb", "application/vnd.debian.binary-package"},
+        {".cbz", "application/vnd.comicbook+zip"},
+        {".cryptonote", "application/vnd.rig.cryptonote"},
+        {".heic", "image/heic"},
+        {".a2l", "application/a2l"},
+        {".wasm", "application/wasm"},
+        {".sxd", "application/vnd.sun.xml.draw"},
+        {".m4s", "video/iso.segment"},
+        {".vsc", "application/vnd.vidsoft.vidconference"},
+        {".atomdeleted", "application/atomdeleted+xml"},
+        {".inkml", "application/inkml+xml"},
+        {".oeb", "application/vnd.openeye.oeb"},
+        {".sac", "application/tamp-sequence-adjust-confirm"},
+        {".hpgl", "application/vnd.hp-hpgl"},
+        {".nnd", "application/vnd.noblenet-directory"},
+        {".ogex", "model/vnd.opengex"},
+        {".rp9", "application/vnd.cloanto.rp9"},
+        {".sl", "text/vnd.wap.sl"},
+        {".efi", "application/efi"},
+        {".xdssc", "application/dssc+xml"},
+        {".evc", "audio/evrc"},
+        {"", ""},
+        {".mads", "application/mads+xml"},
+        {".cuc", "application/tamp-community-update-confirm"},
+        {".atomsvc", "application/atomsvc+xml"},
+        {".rms", "application/vnd.jcp.javame.midlet-rms"},
+        {"", ""},
+        {".vcj", "application/voucher-cms+json"},
+        {".fly", "text/vnd.fly"},
+        {".pyv", "video/vnd.ms-playready.media.pyv"},
+        {".usdz", "model/vnd.usdz+zip"},
+        {".amr", "audio/amr"},
+        {".xltm", "application/vnd.ms-excel.template.macroenabled.12"},
+        {".xlf", "application/xliff+xml"},
+        {".pack", "application/x-java-pack200"},
+        {".p8", "application/pkcs8"},
+        {".xots", "application/vnd.collabio.xodocuments.spreadsheet-template"},
+        {".silo", "model/mesh"},
+        {".ice", "x-conference/x-cooltalk"},
+        {".xca", "application/xcap-caps+xml"},
+        {".mpc", "application/vnd.mophun.certificate"},
+        {".dsm", "application/vnd.desmume.movie"},
+        {".semd", "application/vnd.semd"},
+        {".mpf", "text/vnd.ms-mediapackage"},
+        {".cdmid", "application/cdmi-domain"},
+        {".sam", "application/vnd.lotus-wordpro"},
+        {".cdxml", "application/vnd.chemdraw+xml"},
+        {".xdw", "application/vnd.fujixerox.docuworks"},
+        {".pgm", "image/x-portable-graymap"},
+        {".uvva", "audio/vnd.dece.audio"},
+        {".xpx", "application/vnd.intercon.formnet"},
+        {".ps", "application/postscript"},
+        {".sce", "application/vnd.etsi.asic-e+zip"},
+        {".pbm", "image/x-portable-bitmap"},
+        {".wk4", "application/vnd.lotus-1-2-3"},
+        {".mbk", "application/vnd.mobius.mbk"},
+        {".ttc", "font/collection"},
+        {".rdf", "application/rdf+xml"},
+        {".link66", "application/vnd.route66.link66+xml"},
+        {".scq", "application/scvp-cv-request"},
+        {".mk3d", "video/matroska-3d"},
+        {".senml-etchj", "application/senml-etch+json"},
+        {".t38", "image/t38"},
+        {".vbk", "audio/vnd.nortel.vbk"},
+        {".oth", "application/vnd.oasis.opendocument.text-web"},
+        {".ppsm", "application/vnd.ms-powerpoint.slideshow.macroenabled.12"},
+        {".tuc", "application/tamp-update-confirm"},
+        {".clkx", "application/vnd.crick.clicker"},
+        {".scld", "application/vnd.doremir.scorecloud-binary-document"},
+        {".aal", "audio/atrac-advanced-lossless"},
+        {".vew", "application/vnd.lotus-approach"},
+        {".jxr", "image/jxr"},
+        {".tree", "application/vnd.rainstor.data"},
+        {".rsheet", "application/urc-ressheet+xml"},
+        {".ddd", "application/vnd.fujixerox.ddd"},
+        {".igl", "application/vnd.igloader"},
+        {".dotm", "application/vnd.ms-word.template.macroenabled.12"},
+        {".zfo", "application/vnd.software602.filler.form-xml-zip"},
+        {".mgz", "application/vnd.proteus.magazine"},
+        {".xbd", "application/vnd.fujixerox.docuworks.binder"},
+        {".twds", "application/vnd.simtech-mindmapper"},
+        {".htke", "application/vnd.kenameaapp"},
+        {".smv", "audio/smv"},
+        {".xer", "application/xcap-error+xml"},
+        {".a", "text/vnd.a"},
+        {".odg", "application/vnd.oasis.opendocument.graphics"},
+        {".mxu", "video/vnd.mpegurl"},
+        {".atom", "application/atom+xml"},
+        {".auc", "application/tamp-apex-update-confirm"},
+        {".xhe", "audio/usac"},
+        {".wspolicy", "application/wspolicy+xml"},
+        {"", ""},
+        {".wadl", "application/vnd.sun.wadl+xml"},
+        {".seed", "application/vnd.fdsn.seed"},
+        {".pdf", "application/pdf"},
+        {".bsp", "model/vnd.valve.source.compiled-map"},
+        {".sgml", "text/sgml"},
+        {".ktx", "image/ktx"},
+        {".pdx", "application/pdx"},
+        {".tur", "application/tamp-update"},
+        {".stix", "application/stix+json"},
+        {".vxml", "application/voicexml+xml"},
+        {".scim", "application/scim+json"},
+        {".std", "application/vnd.sun.xml.draw.template"},
+        {".plb", "application/vnd.3gpp.pic-bw-large"},
+        {".susp", "application/vnd.sus-calendar"},
+        {".bmed", "multipart/vnd.bint.med-plus"},
+        {".xar", "application/vnd.xara"},
+        {".semf", "application/vnd.semf"},
+        {".emotionml", "application/emotionml+xml"},
+        {".cii", "application/vnd.anser-web-certificate-issue-initiation"},
+        {".finf", "application/fastinfoset"},
+        {".mmr", "image/vnd.fujixerox.edmics-mmr"},
+        {".sm", "application/vnd.stepmania.stepchart"},
+        {".cif", "application/vnd.multiad.creator.cif"},
+        {".dwd", "application/atsc-dwd+xml"},
+        {".dm", "application/vnd.oma.drm.message"},
+        {".fla", "application/vnd.dtg.local.flash"},
+        {".mpt", "application/vnd.ms-project"},
+        {".dbf", "application/vnd.dbf"},
+        {".osf", "application/vnd.yamaha.openscoreformat"},
+        {".ftc", "application/vnd.fluxtime.clip"},
+        {".tst", "application/vnd.etsi.timestamp-token"},
+        {".dzr", "application/vnd.dzr"},
+        {"", ""},
+        {".ods", "application/vnd.oasis.opendocument.spreadsheet"},
+        {".drle", "image/dicom-rle"},
+        {".rm", "audio/pn-realaudio"},
+        {".fcdt", "application/vnd.adobe.formscentral.fcdt"},
+        {".rpss", "application/vnd.nokia.radio-presets"},
+        {".mmf", "application/vnd.smaf"},
+        {".dis", "application/vnd.mobius.dis"},
+        {".urimap", "application/vnd.uri-map"},
+        {".evb", "audio/evrcb"},
+        {".orq", "application/ocsp-request"},
+        {".xods", "application/vnd.collabio.xodocuments.spreadsheet"},
+        {".ecigprofile", "application/vnd.evolv.ecig.profile"},
+        {".jph", "image/jph"},
+        {".maei", "application/mmt-aei+xml"},
+        {".pseg3820", "application/vnd.afpc.modca"},
+        {".tiff", "image/tiff"},
+        {".heif", "image/heif"},
+        {".docjson", "application/vnd.document+json"},
+        {".wmv", "video/ms-wmv"},
+        {".qps", "application/vnd.publishare-delta-tree"},
+        {".prc", "application/vnd.palm"},
+        {".senml", "application/senml+json"},
+        {".jad", "text/vnd.sun.j2me.app-descriptor"},
+        {".nitf", "application/vnd.nitf"},
+        {".nnw", "application/vnd.noblenet-web"},
+        {".webm", "video/webm"},
+        {".dart", "application/vnd.dart"},
+        {".p7m", "application/pkcs7-mime"},
+        {".azv", "image/vnd.airzip.accelerator.azv"},
+        {".dxp", "application/vnd.spotfire.dxp"},
+        {".sid", "audio/prs.sid"},
+        {".csrattrs", "application/csrattrs"},
+        {".tpt", "application/vnd.trid.tpt"},
+        {".xott", "application/vnd.collabio.xodocuments.document-template"},
+        {".geojson", "application/geo+json"},
+        {".crl", "application/pkix-crl"},
+        {".wmf", "image/wmf"},
+        {".xdm", "application/vnd.syncml.dm+xml"},
+        {".cbr", "application/vnd.comicbook-rar"},
+        {".kil", "application/x-killustrator"},
+        {".zip", "application/zip"},
+        {".csh", "application/x-csh"},
+        {".stl", "model/stl"},
+        {".relo", "application/p2p-overlay+xml"},
+        {".str", "application/vnd.pg.format"},
+        {".mfm", "application/vnd.mfmp"},
+        {".jtd", "text/vnd.esmertec.theme-descriptor"},
+        {"", ""},
+        {".wif", "application/watcherinfo+xml"},
+        {".xml", "text/xml"},
+        {".rtf", "application/rtf"},
+        {".sr", "application/vnd.sigrok.session"},
+        {".smk", "video/vnd.radgamettools.smacker"},
+        {".avcs", "image/avcs"},
+        {".pcl", "application/vnd.hp-pcl"},
+        {".ahead", "application/vnd.ahead.space"},
+        {".jxra", "image/jxra"},
+        {".icm", "application/vnd.iccprofile"},
+        {".et3", "application/vnd.eszigno3+xml"},
+        {".taglet", "application/vnd.mynfc"},
+        {".tgz", "application/gzip"},
+        {".tbz", "application/x-gtar-compressed"},
+        {".dtd", "application/xml-dtd"},
+        {".uvvm", "video/vnd.dece.mobile"},
+        {".csvs", "text/csv-schema"},
+        {".ipfix", "application/ipfix"},
+        {".mft", "application/rpki-manifest"},
+        {".json-patch", "application/json-patch+json"},
+        {".plf", "application/vnd.pocketlearn"},
+        {".spng", "image/vnd.sealed.png"},
+        {".paw", "application/vnd.pawaafile"},
+        {".grv", "application/vnd.groove-injector"},
+        {".shx", "application/vnd.shx"},
+        {".fvt", "video/vnd.fvt"},
+        {".jxsc", "image/jxsc"},
+        {".clkk", "application/vnd.crick.clicker.keyboard"},
+        {".xpm", "image/x-xpixmap"},
+        {".stm", "audio/stm"},
+        {".epub", "application/epub+zip"},
+        {".cea", "application/cea"},
+        {".pfx", "application/pkcs12"},
+    };
+
+    template <size_t B, size_t N>
+    constexpr std::string_view find(const uint16_t (&seeds)[B], const entry (&slots)[N],
+                                    std::string_view key)
+    {
+        const entry &e = slots[hash(key, seeds[hash(key, 0) % B]) % N];
+        return e.key == key ? e.value : std::string_view();
+    }
+
+    /* File extension for a lowercase mimetype, or empty if unknown */
+    constexpr std::string_view extension(std::string_view type)
+    {
+        return find(type_seeds, type_slots, type);
+    }
+
+    /* Mimetype for a file extension (with the dot), or empty if unknown */
+    constexpr std::string_view type(std::string_view extension)
+    {
+        return find(ext_seeds, ext_slots, extension);
+    }
+}
 
 #endif
@@ -0,0 +1,42 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <curl/curl.h>
+#include <map>
+#include <string>
+
+enum class prealloc_mode {
+    NONE,  // Let files grow as they're written
+    KEEP,  // Reserve the blocks, but keep the file size
+    FULL   // Set the file to its full size up front
+};
+
+/*
+ * Run-wide options set by parse_args(). There is only ever one download run
+ * per process, so they are kept in a single global instance.
+ */
+struct options {
+    unsigned int jobs = 1;      // Number of parallel download workers (-j)
+    unsigned int segments = 1;  // Number of connections per file (-s)
+    unsigned int transfers = 0; // Concurrent transfers on the event engine (-e), 0 if unused
+    unsigned int host_connections = 0;  // Most downloads at once from one host (--host-connections), 0 for no limit
+    long http2_streams = 0;     // Most streams on one HTTP/2 connection (--http2), 0 for curl's default
+    long http_version = CURL_HTTP_VERSION_NONE;  // HTTP version to ask for (--http2, --http2-prior-knowledge)
+    unsigned int retries = 3;   // Tries after a failed request, in a row without progress (--retry)
+    long speed_limit = 1;       // Bytes per second a request is stalled below (--speed-limit)
+    long speed_time = 60;       // Seconds below speed_limit before it's dropped (--speed-time), 0 to never
+    double hedge = 0;           // Percent of requests that may be sent twice on a slow first byte (--hedge), 0 for none
+    bool no_head = false;       // Take the metadata from the body request instead of a HEAD (-n)
+    long buffer_size = 0;       // Curl's receive buffer size in bytes (-b), 0 for curl's default
+    long long write_memory = 256 * 1024 * 1024;  // Most bytes of data waiting to be written (--write-memory)
+    prealloc_mode prealloc = prealloc_mode::NONE;  // Preallocation of output files (-a)
+    std::string stats_file;     // Per request telemetry as JSON lines (--stats-json)
+    std::string sync_file;      // Validators from earlier runs, for conditional GETs (--sync)
+    long long limit_rate = 0;   // Bytes per second for the whole run (--limit-rate), 0 for no limit
+    std::map<std::string, long long> host_limits;  // Bytes per second by host (--limit-host)
+    std::map<std::string, long long> path_limits;  // Bytes per second by download path (--limit-path)
+};
+
+inline options opts;
+
+#endif
@@ -0,0 +1,367 @@
+#include "progress.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <thread>
+#include <unistd.h>
+
+#define REDRAW_INTERVAL std::chrono::milliseconds(100)
+#define MAX_ROWS 8       // Downloads shown before the rest are summed up as "+N more"
+#define BAR_WIDTH 16
+#define NAME_WIDTH 24      // Names are padded to this, or cut to fit
+#define MIN_NAME_WIDTH 10
+#define SMOOTHING 0.2    // Weight of the newest sample in the speeds shown
+
+#define KBYTE  double(1024)
+#define MBYTE (double(1024) * KBYTE)
+#define GBYTE (double(1024) * MBYTE)
+#define TBYTE (double(1024) * GBYTE)
+
+#define MINUTE 60
+#define HOUR  (60 * MINUTE)
+#define DAY   (24 * HOUR)
+
+using progress_clock = std::chrono::steady_clock;
+
+namespace progress {
+    struct slot {
+	slot(const std::string &name, curl_off_t size, curl_off_t done)
+	    : name(name), size(size), done(done), last_done(done) {}
+
+	std::string name;
+	std::atomic<curl_off_t> size;
+	std::atomic<curl_off_t> done;
+	// Only touched by the render thread
+	curl_off_t last_done;
+	double speed = 0.0;
+    };
+}
+
+using progress::slot;
+
+static bool enabled = false;
+static std::thread render_thread;
+static std::mutex state_mtx;  // Guards stopping
+static std::condition_variable state_cv;
+static bool stopping = false;
+
+static std::mutex slots_mtx;  // Guards slots, finished and the render state in them
+static std::list<slot> slots;
+static size_t finished = 0;
+static std::atomic<long long> received(0);  // Bytes received by all downloads
+
+static std::mutex draw_mtx;   // Guards the terminal and drawn_lines
+static int drawn_lines = 0;
+
+static void render_loop();
+static std::string build_frame(double elapsed, double &total_speed, long long &last_received);
+static std::string format_row(const slot &s, int width);
+static void format_size(char *buf, size_t size, double bytes);
+static void format_time(char *buf, size_t size, long long secs);
+static void erase();
+static int terminal_width();
+
+
+void progress::init()
+{
+    if (!isatty(STDOUT_FILENO))
+	return;
+
+    enabled = true;
+    stopping = false;
+    render_thread = std::thread(render_loop);
+}
+
+
+void progress::cleanup()
+{
+    if (!enabled)
+	return;
+
+    {
+	std::lock_guard<std::mutex> lock(state_mtx);
+	stopping = true;
+    }
+    state_cv.notify_one();
+    render_thread.join();
+
+    std::lock_guard<std::mutex> lock(draw_mtx);
+    erase();
+    fflush(stdout);
+    enabled = false;
+}
+
+
+slot *progress::add(const std::string &name, curl_off_t size, curl_off_t done)
+{
+    if (!enabled)
+	return nullptr;
+
+    std::lock_guard<std::mutex> lock(slots_mtx);
+    slots.emplace_back(name, size, done);
+    return &slots.back();
+}
+
+
+void progress::reset(slot *bar, const std::string &name, curl_off_t size, curl_off_t done)
+{
+    if (!bar)
+	return;
+
+    std::lock_guard<std::mutex> lock(slots_mtx);
+    bar->name = name;
+    bar->last_done = done;
+    bar->size = size;
+    bar->done = done;
+}
+
+
+void progress::remove(slot *bar)
+{
+    if (!bar)
+	return;
+
+    std::lock_guard<std::mutex> lock(slots_mtx);
+    auto it = std::find_if(slots.begin(), slots.end(),
+			   [bar](const slot &s) { return &s == bar; });
+    if (it != slots.end()) {
+	slots.erase(it);
+	finished++;
+    }
+}
+
+
+void progress::attach(CURL *curl, slot *bar, meter *m)
+{
+    m->bar = bar;
+    m->last = 0;
+
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, bar ? 0L : 1L);
+    if (bar) {
+	curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, xferinfo_callback);
+	curl_easy_setopt(curl, CURLOPT_XFERINFODATA, m);
+    }
+}
+
+
+std::unique_lock<std::mutex> progress::hide()
+{
+    if (!enabled)
+	return std::unique_lock<std::mutex>();
+
+    std::unique_lock<std::mutex> lock(draw_mtx);
+    erase();
+    return lock;
+}
+
+
+/*
+ * Custom callback function for CURLOPT_XFERINFOFUNCTION. Only moves the
+ * counters along; drawing is left to the render thread.
+ */
+int progress::xferinfo_callback(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+				curl_off_t ultotal, curl_off_t ulnow)
+{
+    meter *m = static_cast<meter *>(clientp);
+    curl_off_t delta = dlnow - m->last;
+
+    if (delta > 0) {
+	curl_off_t done = m->bar->done.fetch_add(delta, std::memory_order_relaxed) + delta;
+	received.fetch_add(delta, std::memory_order_relaxed);
+	m->last = dlnow;
+
+	// dltotal counts from where this request started, not from the start of the file
+	if (dltotal > 0 && m->bar->size.load(std::memory_order_relaxed) < 0)
+	    m->bar->size.store(done - dlnow + dltotal, std::memory_order_relaxed);
+    }
+
+    // Must return 0 otherwise the transfer is aborted
+    return 0;
+}
+
+
+/* Redraws the dashboard every REDRAW_INTERVAL until cleanup() */
+static void render_loop()
+{
+    auto last_time = progress_clock::now();
+    long long last_received = 0;
+    double total_speed = 0.0;
+    std::unique_lock<std::mutex> lock(state_mtx);
+
+    while (!state_cv.wait_for(lock, REDRAW_INTERVAL, [] { return stopping; })) {
+	lock.unlock();
+
+	auto now = progress_clock::now();
+	double elapsed = std::chrono::duration<double>(now - last_time).count();
+	last_time = now;
+	std::string frame = build_frame(elapsed, total_speed, last_received);
+	int lines = static_cast<int>(std::count(frame.begin(), frame.end(), '\n'));
+
+	{
+	    std::lock_guard<std::mutex> draw_lock(draw_mtx);
+	    erase();
+	    fwrite(frame.data(), 1, frame.size(), stdout);
+	    fflush(stdout);
+	    drawn_lines = lines;
+	}
+
+	lock.lock();
+    }
+}
+
+
+/*
+ * Builds the dashboard: a row for each of the first MAX_ROWS downloads,
+ * and a line with the totals. Speeds are smoothed over the redraws.
+ */
+static std::string build_frame(double elapsed, double &total_speed, long long &last_received)
+{
+    int width = terminal_width();
+    std::string frame;
+    size_t active;
+    size_t done;
+
+    {
+	std::lock_guard<std::mutex> lock(slots_mtx);
+	size_t row = 0;
+
+	for (slot &s : slots) {
+	    curl_off_t bytes = s.done.load(std::memory_order_relaxed);
+	    double sample = bytes > s.last_done ? (bytes - s.last_done) / elapsed : 0.0;
+	    s.speed = s.speed == 0.0 ? sample : SMOOTHING * sample + (1 - SMOOTHING) * s.speed;
+	    s.last_done = bytes;
+
+	    if (row++ < MAX_ROWS)
+		frame += format_row(s, width);
+	}
+	active = slots.size();
+	done = finished;
+    }
+
+    if (active > MAX_ROWS)
+	frame += " +" + std::to_string(active - MAX_ROWS) + " more\n";
+
+    long long bytes = received.load(std::memory_order_relaxed);
+    double sample = (bytes - last_received) / elapsed;
+    total_speed = total_speed == 0.0 ? sample : SMOOTHING * sample + (1 - SMOOTHING) * total_speed;
+    last_received = bytes;
+
+    char total[32], speed[32], line[128];
+    format_size(total, sizeof(total), bytes);
+    format_size(speed, sizeof(speed), total_speed);
+    snprintf(line, sizeof(line), "%zu active, %zu done, %s received at %s/s",
+	     active, done, total, speed);
+    frame += std::string(line).substr(0, width - 1) + '\n';
+
+    return frame;
+}
+
+
+/*
+ * One download, like
+ *     name   42% [=======         ] 12.34 MiB / 29.00 MiB  4.10 MiB/s  00:04
+ * with the name cut short to leave room for the rest on one line.
+ */
+static std::string format_row(const slot &s, int width)
+{
+    curl_off_t size = s.size.load(std::memory_order_relaxed);
+    curl_off_t done = s.done.load(std::memory_order_relaxed);
+    char bar[BAR_WIDTH + 1];
+    char now[32], total[32], speed[32], left[32] = "--:--";
+    char line[256];
+    int dots = 0;
+    double fraction = 0.0;
+
+    if (size > 0) {
+	fraction = std::min(1.0, static_cast<double>(done) / size);
+	dots = static_cast<int>(fraction * BAR_WIDTH + 0.5);
+	if (s.speed > 0.0)
+	    format_time(left, sizeof(left), static_cast<long long>((size - done) / s.speed));
+    }
+    for (int i = 0; i < BAR_WIDTH; i++)
+	bar[i] = i < dots ? '=' : ' ';
+    bar[BAR_WIDTH] = '\0';
+
+    format_size(now, sizeof(now), done);
+    format_size(speed, sizeof(speed), s.speed);
+    if (size > 0) {
+	format_size(total, sizeof(total), size);
+	snprintf(line, sizeof(line), "  %3.0f%% [%s] %s / %s  %s/s  %s",
+		 fraction * 100, bar, now, total, speed, left);
+    } else
+	snprintf(line, sizeof(line), "       [%s] %s  %s/s", bar, now, speed);
+
+    int name_width = std::min(NAME_WIDTH, width - 1 - static_cast<int>(strlen(line)));
+    name_width = std::max(MIN_NAME_WIDTH, name_width);
+    std::string row = s.name;
+    if (static_cast<int>(row.length()) > name_width) {
+	size_t cut = name_width;
+	// Don't cut a UTF-8 character in half
+	while (cut > 0 && (row[cut] & 0xC0) == 0x80)
+	    cut--;
+	row.resize(cut);
+    }
+    row.resize(std::max<size_t>(row.length(), name_width), ' ');
+    row += line;
+
+    return row.substr(0, width > 1 ? width - 1 : 0) + '\n';
+}
+
+
+/* Prints bytes with a binary unit, like "12.34 MiB" */
+static void format_size(char *buf, size_t size, double bytes)
+{
+    if (bytes >= TBYTE)
+	snprintf(buf, size, "%.2f TiB", bytes / TBYTE);
+    else if (bytes >= GBYTE)
+	snprintf(buf, size, "%.2f GiB", bytes / GBYTE);
+    else if (bytes >= MBYTE)
+	snprintf(buf, size, "%.2f MiB", bytes / MBYTE);
+    else if (bytes >= KBYTE)
+	snprintf(buf, size, "%.2f KiB", bytes / KBYTE);
+    else
+	snprintf(buf, size, "%.0f B", bytes);
+}
+
+
+/* Prints a duration as mm:ss, hh:mm:ss or dD:hh:mm:ss */
+static void format_time(char *buf, size_t size, long long secs)
+{
+    long long days = secs / DAY;
+    int hours = static_cast<int>(secs % DAY / HOUR);
+    int mins = static_cast<int>(secs % HOUR / MINUTE);
+    int s = static_cast<int>(secs % MINUTE);
+
+    if (days)
+	snprintf(buf, size, "%lldD:%02d:%02d:%02d", days, hours, mins, s);
+    else if (hours)
+	snprintf(buf, size, "%02d:%02d:%02d", hours, mins, s);
+    else
+	snprintf(buf, size, "%02d:%02d", mins, s);
+}
+
+
+/* Moves back up over the dashboard and clears it. Called with draw_mtx held */
+static void erase()
+{
+    if (drawn_lines > 0)
+	printf("\x1b[%dA\x1b[J", drawn_lines);
+    drawn_lines = 0;
+}
+
+
+static int terminal_width()
+{
+    struct winsize ws;
+
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_col > 0)
+	return ws.ws_col;
+
+    return 80;
+}
@@ -0,0 +1,61 @@
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+#include <curl/curl.h>
+#include <mutex>
+#include <string>
+
+/*
+ * Progress display for every running download. Transfers only bump atomic
+ * counters from their curl progress callbacks, and a render thread redraws
+ * a dashboard of the active downloads and the total throughput a few times
+ * a second. When stdout isn't a terminal nothing is set up at all, and
+ * transfers run without a progress callback.
+ */
+namespace progress {
+    /* One download on the dashboard */
+    struct slot;
+
+    /*
+     * Per curl handle state for xferinfo_callback(). A download split over
+     * several handles has one meter for each, all on the same slot.
+     */
+    struct meter {
+	slot *bar = nullptr;
+	curl_off_t last = 0;  // dlnow at the previous callback
+    };
+
+    /* Starts the render thread if stdout is a terminal */
+    void init();
+    /* Stops the render thread and clears the dashboard */
+    void cleanup();
+
+    /*
+     * Puts a download on the dashboard. size is the full size of the file,
+     * or -1 if not known yet, and done how much of it is already on disk.
+     * Returns nullptr when there's no dashboard.
+     */
+    slot *add(const std::string &name, curl_off_t size, curl_off_t done);
+    /* Starts the count over, when a download has to start again or turns out to have another name */
+    void reset(slot *bar, const std::string &name, curl_off_t size, curl_off_t done);
+    /* Takes a download off the dashboard. The handles using it must be done */
+    void remove(slot *bar);
+
+    /*
+     * Sets curl up to report to bar through m, or turns its progress
+     * callback off if bar is nullptr. Call before every request.
+     */
+    void attach(CURL *curl, slot *bar, meter *m);
+
+    /*
+     * Erases the dashboard so a log line can be printed in its place. It's
+     * drawn again at the next redraw, once the returned lock is released.
+     */
+    std::unique_lock<std::mutex> hide();
+
+    /* Custom callback function for CURLOPT_XFERINFOFUNCTION, with a meter in CURLOPT_XFERINFODATA */
+    int xferinfo_callback(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+			  curl_off_t ultotal, curl_off_t ulnow);
+}
+
+#endif
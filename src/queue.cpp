@@ -0,0 +1,201 @@
+#include "queue.h"
+#include "hostname.h"
+#include "logger.h"
+#include "options.h"
+
+#include <algorithm>
+
+// How much further than its capacity the queue may read ahead for idle workers
+#define LOOKAHEAD 16
+// Hosts listed by report()
+#define REPORT_HOSTS 5
+
+struct workqueue::host {
+    std::string name;
+    std::deque<urldata> entries;
+    unsigned int active = 0;  // Downloads running
+    bool in_ready = false;
+    size_t peak = 0;   // Most entries queued at once
+    size_t total = 0;  // Downloads handed out
+};
+
+
+workqueue::workqueue(size_t workers, size_t capacity)
+    : affinity(workers > 0 ? workers : 1, nullptr), capacity(capacity > 0 ? capacity : 1)
+{
+}
+
+
+workqueue::~workqueue() = default;
+
+
+/*
+ * Adds an entry to the queue of its host. Blocks while the queue is full,
+ * unless the workers are waiting on hosts at their limit, when it reads
+ * further ahead for other hosts. Only one thread may push.
+ */
+void workqueue::push(urldata data)
+{
+    std::string name = url_host(data.url);
+    std::unique_lock<std::mutex> lock(mtx);
+
+    space_cv.wait(lock, [this] {
+	return pending < capacity
+	    || ((starved > 0 || poll_starved) && pending < capacity * LOOKAHEAD);
+    });
+
+    std::unique_ptr<host> &h = hosts[name];
+    if (!h) {
+	h = std::make_unique<host>();
+	h->name = name;
+    }
+    h->entries.push_back(std::move(data));
+    h->peak = std::max(h->peak, h->entries.size());
+    if (!h->in_ready) {
+	ready.push_back(h.get());
+	h->in_ready = true;
+    }
+
+    pending++;
+    wait_cv.notify_one();
+}
+
+
+/* Marks the queue as complete. Workers return once it's drained */
+void workqueue::close()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    closed = true;
+    wait_cv.notify_all();
+}
+
+
+/*
+ * Gets the next entry for worker. Blocks until an entry for a host below
+ * its limit is available. Returns false when the queue is closed and empty.
+ */
+bool workqueue::pop(size_t worker, urldata &data)
+{
+    std::unique_lock<std::mutex> lock(mtx);
+
+    for (;;) {
+	if (take(worker, data))
+	    return true;
+	if (closed && pending == 0)
+	    return false;
+
+	// Everything queued is for hosts at their limit, so look further ahead
+	bool capped = pending > 0;
+	if (capped) {
+	    starved++;
+	    space_cv.notify_one();
+	}
+	wait_cv.wait(lock);
+	if (capped)
+	    starved--;
+    }
+}
+
+
+/*
+ * Same as pop(), but returns false right away if there's nothing to take.
+ * A caller that finds only hosts at their limit counts as starved until it
+ * takes something, since it comes back for more without waiting in pop().
+ */
+bool workqueue::try_pop(size_t worker, urldata &data)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (take(worker, data))
+	return true;
+    if (pending > 0 && !poll_starved) {
+	poll_starved = true;
+	space_cv.notify_one();
+    }
+
+    return false;
+}
+
+
+/* Tells the queue that worker is done with the download of url */
+void workqueue::finished(size_t worker, const std::string &url)
+{
+    std::string name = url_host(url);
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = hosts.find(name);
+    if (it == hosts.end())
+	return;
+    host *h = it->second.get();
+    bool was_full = opts.host_connections > 0 && h->active == opts.host_connections;
+    h->active--;
+    affinity[worker] = h;
+    // Only a host that was at its limit can have kept a worker waiting
+    if (was_full && !h->entries.empty())
+	wait_cv.notify_one();
+}
+
+
+/* Logs how many downloads the busiest hosts had, and how deep their queues got */
+void workqueue::report()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<host *> busiest;
+
+    for (auto &it : hosts)
+	busiest.push_back(it.second.get());
+    std::sort(busiest.begin(), busiest.end(),
+	      [](const host *a, const host *b) { return a->total > b->total; });
+
+    for (size_t i = 0; i < busiest.size() && i < REPORT_HOSTS; i++) {
+	const host *h = busiest[i];
+	log(info[QUEUE_INFO_HOST], h->name.empty() ? "(none)" : h->name,
+	    {{"downloads", static_cast<long long>(h->total)},
+	     {"peak_queued", static_cast<long long>(h->peak)}});
+    }
+    if (busiest.size() > REPORT_HOSTS)
+	log(info[QUEUE_INFO_MORE], static_cast<long>(busiest.size() - REPORT_HOSTS));
+}
+
+
+/*
+ * Takes the next entry for worker, with mtx held. That's the next one for
+ * the host of its last download if there is one, and otherwise the next one
+ * for the next host in turn that's below its limit.
+ */
+bool workqueue::take(size_t worker, urldata &data)
+{
+    unsigned int limit = opts.host_connections;
+    host *h = affinity[worker];
+
+    affinity[worker] = nullptr;
+    if (h && (h->entries.empty() || (limit > 0 && h->active >= limit)))
+	h = nullptr;
+
+    for (size_t n = ready.size(); !h && n > 0; n--) {
+	host *next = ready.front();
+	ready.pop_front();
+	if (next->entries.empty()) {
+	    next->in_ready = false;
+	    continue;
+	}
+	ready.push_back(next);
+	if (limit == 0 || next->active < limit)
+	    h = next;
+    }
+    if (!h)
+	return false;
+
+    poll_starved = false;
+    data = std::move(h->entries.front());
+    h->entries.pop_front();
+    h->active++;
+    h->total++;
+    pending--;
+    space_cv.notify_one();
+    // Workers waiting on hosts at their limit have nothing left to wait for
+    if (closed && pending == 0)
+	wait_cv.notify_all();
+
+    return true;
+}
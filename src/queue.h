@@ -0,0 +1,77 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct urldata
+{
+    std::string url;
+    std::string filename;
+    std::shared_ptr<const std::string> path;  // Shared by every entry for the same -p
+    std::string checksum;  // Expected digest, empty if none
+};
+
+/*
+ * Queue of urldata entries, grouped by host. Workers take entries from the
+ * hosts in turn, so a list with many urls for one host in a row doesn't put
+ * them all on that host at once while the others sit idle, and no host gets
+ * more than opts.host_connections downloads at a time. A worker that has
+ * just finished a download goes on with the same host if it can, while the
+ * connection it used is still warm.
+ */
+class workqueue {
+public:
+    /* At most capacity entries are queued at a time, see push() */
+    workqueue(size_t workers, size_t capacity);
+    ~workqueue();
+
+    /*
+     * Adds an entry to the queue of its host. Blocks while the queue is
+     * full, unless the workers are waiting on hosts at their limit, when
+     * it reads further ahead for other hosts. Only one thread may push.
+     */
+    void push(urldata data);
+    /* Marks the queue as complete. Workers return once it's drained */
+    void close();
+    /*
+     * Gets the next entry for worker. Blocks until an entry for a host
+     * below its limit is available. Returns false when the queue is closed
+     * and empty.
+     */
+    bool pop(size_t worker, urldata &data);
+    /*
+     * Same as pop(), but returns false right away if there's nothing to
+     * take. Reads ahead for other hosts like pop() when that's because of
+     * their limits.
+     */
+    bool try_pop(size_t worker, urldata &data);
+    /* Tells the queue that worker is done with the download of url */
+    void finished(size_t worker, const std::string &url);
+    /* Logs how many downloads the busiest hosts had, and how deep their queues got */
+    void report();
+
+private:
+    struct host;
+
+    bool take(size_t worker, urldata &data);
+
+    std::mutex mtx;
+    std::unordered_map<std::string, std::unique_ptr<host>> hosts;
+    std::deque<host *> ready;  // Hosts with entries, in turn. May hold empty ones too
+    std::vector<host *> affinity;  // Host of the last download of each worker
+    size_t capacity;
+    size_t pending = 0;  // Entries queued
+    size_t starved = 0;  // Workers waiting while there are entries, all for hosts at their limit
+    bool poll_starved = false;  // try_pop() found only hosts at their limit, see there
+    std::condition_variable wait_cv;
+    std::condition_variable space_cv;  // For push() waiting on a full queue
+    bool closed = false;
+};
+
+#endif
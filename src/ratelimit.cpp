@@ -0,0 +1,222 @@
+#include "ratelimit.h"
+#include "hostname.h"
+#include "options.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+// How far a bucket may run ahead of real time before transfers have to wait
+#define TOLERANCE_NS (100 * 1000000LL)
+// Shorter waits aren't worth pausing or sleeping for
+#define MIN_WAIT_NS (1000000LL)
+
+using ratelimit::bucket;
+using ratelimit::gate;
+
+class ratelimit::bucket {
+public:
+    explicit bucket(long long rate) : ns_per_byte(1e9 / rate) {}
+
+    /*
+     * Charges len bytes received at now. Returns how many nanoseconds the
+     * transfer should wait before it reads more.
+     */
+    long long take(size_t len, long long now)
+    {
+	long long cost = static_cast<long long>(len * ns_per_byte);
+	long long old = tat.load(std::memory_order_relaxed);
+	long long next;
+
+	// Time spent idle isn't saved up, beyond the tolerance
+	do {
+	    next = std::max(old, now) + cost;
+	} while (!tat.compare_exchange_weak(old, next, std::memory_order_relaxed));
+
+	return next - now - TOLERANCE_NS;
+    }
+
+private:
+    double ns_per_byte;
+    std::atomic<long long> tat{0};  // Theoretical arrival time of the next byte
+};
+
+static std::unique_ptr<bucket> global;
+static std::map<std::string, std::unique_ptr<bucket>> hosts;
+static std::map<std::string, std::unique_ptr<bucket>> paths;
+
+// Paused transfers on the event engine, soonest first. Only used by the engine thread
+static std::vector<std::pair<long long, CURL *>> wakeups;
+static auto wakeup_order = [](const std::pair<long long, CURL *> &a,
+			      const std::pair<long long, CURL *> &b) {
+    return a.first > b.first;
+};
+
+static long long now_ns();
+
+
+void ratelimit::init()
+{
+    if (opts.limit_rate > 0)
+	global = std::make_unique<bucket>(opts.limit_rate);
+    for (const auto &limit : opts.host_limits)
+	hosts[limit.first] = std::make_unique<bucket>(limit.second);
+    for (const auto &limit : opts.path_limits)
+	paths[limit.first] = std::make_unique<bucket>(limit.second);
+}
+
+
+void ratelimit::cleanup()
+{
+    global.reset();
+    hosts.clear();
+    paths.clear();
+    wakeups.clear();
+}
+
+
+void ratelimit::attach(CURL *curl, gate *g, const std::string &url, const std::string &path,
+		       curl_write_callback write, void *data)
+{
+    g->count = 0;
+    if (global)
+	g->buckets[g->count++] = global.get();
+    if (!hosts.empty()) {
+	auto it = hosts.find(url_host(url));
+	if (it != hosts.end())
+	    g->buckets[g->count++] = it->second.get();
+    }
+    if (!paths.empty()) {
+	auto it = paths.find(path);
+	if (it != paths.end())
+	    g->buckets[g->count++] = it->second.get();
+    }
+
+    g->curl = curl;
+    g->write = write;
+    g->data = data;
+    if (g->count == 0) {
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, data);
+	return;
+    }
+
+    g->pause = opts.transfers > 0;
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, g);
+}
+
+
+long ratelimit::next_wakeup()
+{
+    if (wakeups.empty())
+	return -1;
+
+    long long wait = wakeups.front().first - now_ns();
+    // Round up, so we don't wake just before it's due
+    return wait > 0 ? static_cast<long>((wait + 999999) / 1000000) : 0;
+}
+
+
+void ratelimit::wake()
+{
+    long long now = now_ns();
+
+    while (!wakeups.empty() && wakeups.front().first <= now) {
+	CURL *curl = wakeups.front().second;
+	std::pop_heap(wakeups.begin(), wakeups.end(), wakeup_order);
+	wakeups.pop_back();
+	// May call the write callback right away, which can pause it again
+	curl_easy_pause(curl, CURLPAUSE_CONT);
+    }
+}
+
+
+void ratelimit::forget(CURL *curl)
+{
+    auto end = std::remove_if(wakeups.begin(), wakeups.end(),
+			      [curl](const std::pair<long long, CURL *> &w) { return w.second == curl; });
+    if (end != wakeups.end()) {
+	wakeups.erase(end, wakeups.end());
+	std::make_heap(wakeups.begin(), wakeups.end(), wakeup_order);
+    }
+}
+
+
+long long ratelimit::parse_rate(const std::string &rate)
+{
+    char *end;
+    double value = strtod(rate.c_str(), &end);
+
+    switch (*end) {
+    case 'g': case 'G':
+	value *= 1024;
+	[[fallthrough]];
+    case 'm': case 'M':
+	value *= 1024;
+	[[fallthrough]];
+    case 'k': case 'K':
+	value *= 1024;
+	end++;
+	break;
+    }
+
+    if (end == rate.c_str() || *end != '\0' || value < 1)
+	return -1;
+
+    return static_cast<long long>(value);
+}
+
+
+/*
+ * Custom callback function for CURLOPT_WRITEFUNCTION. Hands the data on,
+ * then charges it to the gate's buckets and holds the transfer back for as
+ * long as the most overdrawn of them needs.
+ */
+size_t ratelimit::write_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    gate *g = static_cast<gate *>(userdata);
+    size_t written = g->write(ptr, size, nmemb, g->data);
+
+    if (written != size * nmemb)
+	return written;
+
+    long long now = now_ns();
+    long long wait = 0;
+    for (int i = 0; i < g->count; i++)
+	wait = std::max(wait, g->buckets[i]->take(written, now));
+
+    if (wait >= MIN_WAIT_NS) {
+	if (g->pause) {
+	    curl_easy_pause(g->curl, CURLPAUSE_RECV);
+	    wakeups.emplace_back(now + wait, g->curl);
+	    std::push_heap(wakeups.begin(), wakeups.end(), wakeup_order);
+	} else
+	    std::this_thread::sleep_for(std::chrono::nanoseconds(wait));
+    }
+
+    return written;
+}
+
+
+/* Passes data on the way attach() set curl up to, for a callback standing in front of it */
+size_t ratelimit::deliver(char *ptr, size_t size, size_t nmemb, gate *g)
+{
+    if (g->count > 0)
+	return write_callback(ptr, size, nmemb, g);
+
+    return g->write(ptr, size, nmemb, g->data);
+}
+
+
+static long long now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+	std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
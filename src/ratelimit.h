@@ -0,0 +1,68 @@
+#ifndef RATELIMIT_H
+#define RATELIMIT_H
+
+#include <curl/curl.h>
+#include <string>
+
+/*
+ * Bandwidth limits shared by every transfer in the run (--limit-rate), with
+ * optional sub-limits per host (--limit-host) and per download path
+ * (--limit-path). Each limit is a token bucket kept as a virtual clock (GCRA):
+ * received bytes move the bucket's clock forward by size / rate, and a
+ * transfer whose buckets have run ahead of real time waits until they've
+ * caught up again before it reads more. Since a waiting transfer doesn't
+ * hold on to any budget, the others keep the total right at the limit.
+ *
+ * Transfers on worker threads sleep in their write callback. Transfers on
+ * the event engine are paused instead, and woken by the engine through
+ * next_wakeup() and wake().
+ */
+namespace ratelimit {
+    class bucket;
+
+    /*
+     * Per curl handle state for write_callback(). write and data are set
+     * by attach() whether or not there are limits, so the data can be
+     * passed on with deliver().
+     */
+    struct gate {
+	bucket *buckets[3];  // Global, host and path limits that apply
+	int count = 0;
+	bool pause = false;  // Pause the handle instead of sleeping
+	CURL *curl = nullptr;  // The handle to pause, changed when another one takes over
+	curl_write_callback write = nullptr;
+	void *data = nullptr;
+    };
+
+    /* Sets up the buckets for the limits in opts */
+    void init();
+    void cleanup();
+
+    /*
+     * Sets curl up to pass its data to write with data, held back by the
+     * limits for url and path. Without any limits that apply, write is set
+     * as the write callback directly. Call before every request.
+     */
+    void attach(CURL *curl, gate *g, const std::string &url, const std::string &path,
+		curl_write_callback write, void *data);
+
+    /* Milliseconds until the next paused transfer should be woken, or -1 if none */
+    long next_wakeup();
+    /* Unpauses the transfers that have waited long enough */
+    void wake();
+    /* Drops any pending wakeup for curl, once it's no longer on the engine */
+    void forget(CURL *curl);
+
+    /*
+     * Parses a rate like 500K, 2.5M or 1G, in bytes per second with binary
+     * units. Returns -1 if it isn't one.
+     */
+    long long parse_rate(const std::string &rate);
+
+    /* Custom callback function for CURLOPT_WRITEFUNCTION, with a gate in CURLOPT_WRITEDATA */
+    size_t write_callback(char *ptr, size_t size, size_t nmemb, void *userdata);
+    /* Passes data on the way attach() set curl up to, for a callback standing in front of it */
+    size_t deliver(char *ptr, size_t size, size_t nmemb, gate *g);
+}
+
+#endif
@@ -0,0 +1,250 @@
+#include "stats.h"
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <fcntl.h>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <unistd.h>
+
+// Buffered records are written out once there's this much of them
+#define FLUSH_SIZE (64 * 1024)
+// Or at the latest this often, so the file can be followed during a run
+#define FLUSH_INTERVAL std::chrono::seconds(1)
+
+static int fd = -1;
+static std::thread flusher;
+static std::mutex buf_mtx;  // Guards pending and stopping
+static std::condition_variable buf_cv;
+static std::string pending;
+static bool stopping = false;
+
+static void flush_loop();
+static void write_all(const std::string &data);
+static void append_string(std::string &out, const char *key, const std::string &value);
+static size_t utf8_length(const unsigned char *p, size_t left);
+static const char *http_version(long version);
+
+
+bool stats::init(const std::string &file)
+{
+    fd = open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+	return false;
+
+    stopping = false;
+    pending.reserve(2 * FLUSH_SIZE);
+    flusher = std::thread(flush_loop);
+
+    return true;
+}
+
+
+void stats::cleanup()
+{
+    if (fd < 0)
+	return;
+
+    {
+	std::lock_guard<std::mutex> lock(buf_mtx);
+	stopping = true;
+    }
+    buf_cv.notify_one();
+    flusher.join();
+
+    close(fd);
+    fd = -1;
+}
+
+
+void stats::record(CURL *curl, CURLcode res, const request &req)
+{
+    if (fd < 0)
+	return;
+
+    curl_off_t namelookup = 0, connect = 0, appconnect = 0, pretransfer = 0;
+    curl_off_t starttransfer = 0, total = 0, bytes = 0, speed = 0;
+    long status = 0, version = 0, connects = 0;
+
+    curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME_T, &namelookup);
+    curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &appconnect);
+    curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &pretransfer);
+    curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &starttransfer);
+    curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &total);
+    curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &bytes);
+    curl_easy_getinfo(curl, CURLINFO_SPEED_DOWNLOAD_T, &speed);
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+    curl_easy_getinfo(curl, CURLINFO_HTTP_VERSION, &version);
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+
+    double now = std::chrono::duration<double>(
+	std::chrono::system_clock::now().time_since_epoch()).count();
+    // A request that never got as far as sending didn't reuse anything
+    bool reused = connects == 0 && pretransfer > 0;
+
+    std::string line;
+    char num[512];
+    line.reserve(512 + req.url.length() + req.file.length());
+
+    snprintf(num, sizeof(num), "{\"time\":%.3f", now);
+    line += num;
+    append_string(line, "url", req.url);
+    append_string(line, "file", req.file);
+    snprintf(num, sizeof(num),
+	     ",\"request\":\"%s\",\"attempt\":%u,\"resume_from\":%lld,\"status\":%ld,"
+	     "\"http_version\":%s,\"reused\":%s,\"result\":%d",
+	     req.kind, req.attempt, req.resume_from, status,
+	     http_version(version), reused ? "true" : "false", static_cast<int>(res));
+    line += num;
+    if (res == CURLE_OK)
+	line += ",\"error\":null";
+    else
+	append_string(line, "error", curl_easy_strerror(res));
+    snprintf(num, sizeof(num),
+	     ",\"bytes\":%lld,\"speed\":%lld,\"namelookup_us\":%lld,\"connect_us\":%lld,"
+	     "\"appconnect_us\":%lld,\"pretransfer_us\":%lld,\"starttransfer_us\":%lld,"
+	     "\"total_us\":%lld}\n",
+	     static_cast<long long>(bytes), static_cast<long long>(speed),
+	     static_cast<long long>(namelookup), static_cast<long long>(connect),
+	     static_cast<long long>(appconnect), static_cast<long long>(pretransfer),
+	     static_cast<long long>(starttransfer), static_cast<long long>(total));
+    line += num;
+
+    std::lock_guard<std::mutex> lock(buf_mtx);
+    pending += line;
+    if (pending.size() >= FLUSH_SIZE)
+	buf_cv.notify_one();
+}
+
+
+/* Writes out the buffer whenever it fills up, or a second has gone by */
+static void flush_loop()
+{
+    std::string writing;
+    writing.reserve(2 * FLUSH_SIZE);
+
+    std::unique_lock<std::mutex> lock(buf_mtx);
+    for (;;) {
+	buf_cv.wait_for(lock, FLUSH_INTERVAL,
+			[] { return stopping || pending.size() >= FLUSH_SIZE; });
+	bool stop = stopping;
+	writing.swap(pending);
+
+	// Transfers go on adding to the other buffer while this one is written
+	lock.unlock();
+	write_all(writing);
+	writing.clear();
+	lock.lock();
+
+	if (stop)
+	    break;
+    }
+}
+
+
+static void write_all(const std::string &data)
+{
+    size_t done = 0;
+
+    while (done < data.length()) {
+	ssize_t n = write(fd, data.data() + done, data.length() - done);
+	if (n < 0 && errno == EINTR)
+	    continue;
+	if (n <= 0)
+	    return;
+	done += n;
+    }
+}
+
+
+/*
+ * Appends ,"key":"value" to out, with value escaped for JSON. Bytes that
+ * aren't valid UTF-8, like those of a percent-decoded file name in another
+ * charset, are written as the code point of the same value (\u00XX), so
+ * the line still parses.
+ */
+static void append_string(std::string &out, const char *key, const std::string &value)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(value.data());
+    size_t left = value.length();
+
+    out += ",\"";
+    out += key;
+    out += "\":\"";
+    while (left > 0) {
+	unsigned char c = *p;
+	size_t n = c < 0x80 ? 1 : utf8_length(p, left);
+
+	if (c == '"' || c == '\\') {
+	    out += '\\';
+	    out += c;
+	} else if (c < 0x20 || n == 0) {
+	    char esc[8];
+	    snprintf(esc, sizeof(esc), "\\u%04x", c);
+	    out += esc;
+	    n = 1;
+	} else
+	    out.append(reinterpret_cast<const char *>(p), n);
+	p += n;
+	left -= n;
+    }
+    out += '"';
+}
+
+
+/*
+ * Length of the UTF-8 sequence at p, which starts with a byte of 0x80 or
+ * more, or 0 if it isn't a valid one. Overlong forms and surrogates aren't.
+ */
+static size_t utf8_length(const unsigned char *p, size_t left)
+{
+    size_t n;
+    unsigned char lo = 0x80, hi = 0xbf;  // Range of the second byte
+
+    if (p[0] >= 0xc2 && p[0] <= 0xdf)
+	n = 2;
+    else if (p[0] >= 0xe0 && p[0] <= 0xef) {
+	n = 3;
+	if (p[0] == 0xe0)
+	    lo = 0xa0;
+	else if (p[0] == 0xed)
+	    hi = 0x9f;
+    } else if (p[0] >= 0xf0 && p[0] <= 0xf4) {
+	n = 4;
+	if (p[0] == 0xf0)
+	    lo = 0x90;
+	else if (p[0] == 0xf4)
+	    hi = 0x8f;
+    } else
+	return 0;
+
+    if (left < n || p[1] < lo || p[1] > hi)
+	return 0;
+    for (size_t i = 2; i < n; i++) {
+	if (p[i] < 0x80 || p[i] > 0xbf)
+	    return 0;
+    }
+
+    return n;
+}
+
+
+/* CURLINFO_HTTP_VERSION as a JSON value */
+static const char *http_version(long version)
+{
+    switch (version) {
+    case CURL_HTTP_VERSION_1_0:
+	return "\"1.0\"";
+    case CURL_HTTP_VERSION_1_1:
+	return "\"1.1\"";
+    case CURL_HTTP_VERSION_2_0:
+	return "\"2\"";
+    case CURL_HTTP_VERSION_3:
+	return "\"3\"";
+    default:
+	return "null";
+    }
+}
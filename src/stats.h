@@ -0,0 +1,38 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <curl/curl.h>
+#include <string>
+
+/*
+ * Per request telemetry (--stats-json). Every request a download makes, the
+ * header request, the body and its retries, and each segment, gets one line
+ * of JSON with curl's timings for it, from the DNS lookup to the last byte,
+ * along with its size, speed, HTTP version and outcome. That's enough to
+ * tell whether a slow run waited on DNS, TLS handshakes, the server or the
+ * bandwidth.
+ *
+ * Lines are formatted by the transfer that made the request, but only added
+ * to a buffer there. A background thread writes the buffer out in large
+ * chunks, so the file never holds up a transfer.
+ */
+namespace stats {
+    /* One request, as the transfer saw it */
+    struct request {
+	const char *kind;         // "head", "body" or "segment"
+	const std::string &url;
+	const std::string &file;  // Where the body went, empty if not known yet
+	long long resume_from;    // First byte asked for, 0 for the whole file
+	unsigned int attempt;     // 0 for the first try, then the number of the retry
+    };
+
+    /* Starts writing records to file. Returns false if it can't be opened */
+    bool init(const std::string &file);
+    /* Writes out the records still buffered and closes the file */
+    void cleanup();
+
+    /* Records the request just performed on curl, which ended with res */
+    void record(CURL *curl, CURLcode res, const request &req);
+}
+
+#endif
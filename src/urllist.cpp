@@ -0,0 +1,148 @@
+#include "urllist.h"
+#include "digest.h"
+#include "logger.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Size of the chunks stdin and pipes are read in
+#define CHUNK_SIZE (1024 * 1024)
+// How much of a mapped list to read before handing the pages back
+#define RELEASE_SIZE (16 * 1024 * 1024)
+
+
+urllist::~urllist()
+{
+    if (map)
+	munmap(map, map_size);
+    if (fd > 0)
+	close(fd);
+}
+
+
+bool urllist::open(const std::string &file, std::shared_ptr<const std::string> path)
+{
+    struct stat st;
+
+    this->path = path;
+    fd = file == "-" ? STDIN_FILENO : ::open(file.c_str(), O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0)
+	return false;
+
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+	void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (p != MAP_FAILED) {
+	    map = static_cast<char *>(p);
+	    map_size = st.st_size;
+	    madvise(map, map_size, MADV_SEQUENTIAL);
+	    cur = map;
+	    end = map + map_size;
+	    eof = true;
+	    return true;
+	}
+    }
+
+    buf.resize(CHUNK_SIZE);
+    cur = end = buf.data();
+
+    return true;
+}
+
+
+bool urllist::next(urldata &data)
+{
+    std::string_view line;
+
+    while (next_line(&line)) {
+	if (line.empty() || line[0] == ' ')
+	    continue;
+
+	// An expected digest can go last, like sha256:<hex>
+	data.checksum.clear();
+	size_t space = line.rfind(' ');
+	if (space != std::string_view::npos && digest::looks_like(line.substr(space + 1))) {
+	    data.checksum = line.substr(space + 1);
+	    if (!digest::valid(data.checksum)) {
+		log(err[ARG_ERR_DIGEST], data.checksum);
+		continue;
+	    }
+	    size_t last = line.find_last_not_of(' ', space);
+	    line = line.substr(0, last == std::string_view::npos ? 0 : last + 1);
+	}
+
+	space = line.find(' ');
+	if (space != std::string_view::npos) {
+	    data.url = line.substr(0, space);
+	    data.filename = line.substr(space + 1);
+	} else {
+	    data.url = line;
+	    data.filename.clear();
+	}
+	data.path = path;
+	return true;
+    }
+
+    return false;
+}
+
+
+/*
+ * Gets the next line, without its line ending. The line stays valid until
+ * the next call. Returns false at the end of the list.
+ */
+bool urllist::next_line(std::string_view *line)
+{
+    for (;;) {
+	const char *nl = static_cast<const char *>(memchr(cur, '\n', end - cur));
+
+	if (nl || (eof && cur < end)) {
+	    const char *stop = nl ? nl : end;
+	    *line = std::string_view(cur, stop - cur);
+	    if (!line->empty() && line->back() == '\r')
+		line->remove_suffix(1);
+	    cur = nl ? nl + 1 : end;
+
+	    // Hand back what we're done with, so a long list doesn't pile up in memory
+	    if (map && cur - map - released >= RELEASE_SIZE) {
+		size_t upto = (cur - map) & ~(static_cast<size_t>(sysconf(_SC_PAGESIZE)) - 1);
+		madvise(map + released, upto - released, MADV_DONTNEED);
+		released = upto;
+	    }
+	    return true;
+	}
+
+	if (eof || !fill())
+	    return false;
+    }
+}
+
+
+/*
+ * Reads the next chunk from a list that isn't mapped, keeping the partial
+ * line at the end of the last one. Returns false if there's nothing more.
+ */
+bool urllist::fill()
+{
+    size_t left = end - cur;
+
+    memmove(buf.data(), cur, left);
+    // A line longer than the buffer
+    if (left == buf.size())
+	buf.resize(buf.size() * 2);
+
+    ssize_t n;
+    do {
+	n = read(fd, buf.data() + left, buf.size() - left);
+    } while (n < 0 && errno == EINTR);
+
+    cur = buf.data();
+    end = buf.data() + left + (n > 0 ? n : 0);
+    if (n <= 0)
+	eof = true;
+
+    return n > 0 || left > 0;
+}
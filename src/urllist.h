@@ -0,0 +1,52 @@
+#ifndef URLLIST_H
+#define URLLIST_H
+
+#include "queue.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Reader for the url lists given with -f, one entry at a time, so the
+ * downloads can start while the rest of the list is still unread. Regular
+ * files are memory mapped and split in place, and the pages behind the
+ * reader are handed back as it goes, so even a list of millions of lines
+ * only ever has a few megabytes of it in memory. Stdin ("-") and pipes are
+ * read in chunks instead.
+ *
+ * Every line is <url> [filename] [<algorithm>:<hex>]. Empty lines and lines
+ * starting with a space are skipped.
+ */
+class urllist {
+public:
+    urllist() = default;
+    ~urllist();
+    urllist(const urllist &) = delete;
+    urllist &operator=(const urllist &) = delete;
+
+    /*
+     * Opens the list in file, or stdin for "-", for downloads into path.
+     * Returns false if it can't be read.
+     */
+    bool open(const std::string &file, std::shared_ptr<const std::string> path);
+    /* Gets the next entry. Returns false at the end of the list */
+    bool next(urldata &data);
+
+private:
+    bool next_line(std::string_view *line);
+    bool fill();
+
+    int fd = -1;
+    std::shared_ptr<const std::string> path;
+    char *map = nullptr;  // The whole file, if it's mapped
+    size_t map_size = 0;
+    size_t released = 0;  // Bytes at the start of map already handed back
+    std::vector<char> buf;  // Otherwise the chunk being read
+    const char *cur = nullptr;  // Start of the next line
+    const char *end = nullptr;  // End of the data we have
+    bool eof = false;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#include "validators.h"
+#include "fileops.h"
+#include "journal.h"
+
+#include <fstream>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unordered_map>
+
+// First line of the store, to tell ours apart and version the format
+#define VALIDATORS_MAGIC "curler-sync 2"
+
+using validators::entry;
+
+static std::string store;  // Path of the store, empty if --sync wasn't given
+static std::unordered_map<std::string, entry> entries;
+static std::mutex mtx;
+static bool dirty = false;
+
+
+void validators::load(const std::string &file)
+{
+    std::ifstream in(file);
+    std::string line;
+
+    store = file;
+    if (!in.is_open() || !std::getline(in, line) || line != VALIDATORS_MAGIC)
+	return;
+
+    // url, filename, fullpath, etag, last-modified, size, mtime
+    while (std::getline(in, line)) {
+	std::string fields[7];
+	size_t start = 0;
+	int n = 0;
+
+	for (; n < 7 && start <= line.length(); n++) {
+	    size_t tab = line.find('\t', start);
+	    if (tab == std::string::npos)
+		tab = line.length();
+	    fields[n] = line.substr(start, tab - start);
+	    start = tab + 1;
+	}
+	if (n < 7 || fields[0].empty() || fields[2].empty())
+	    continue;
+
+	entry &e = entries[fields[0]];
+	e.filename = fields[1];
+	e.fullpath = fields[2];
+	e.etag = fields[3];
+	e.last_modified = fields[4];
+	e.size = atoll(fields[5].c_str());
+	e.mtime = static_cast<time_t>(atoll(fields[6].c_str()));
+    }
+}
+
+
+bool validators::save()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (store.empty() || !dirty)
+	return true;
+
+    std::string tmp = store + ".tmp";
+    {
+	std::ofstream out(tmp, std::ios::trunc);
+	out << VALIDATORS_MAGIC << '\n';
+	for (const auto &it : entries) {
+	    const entry &e = it.second;
+	    out << it.first << '\t' << e.filename << '\t' << e.fullpath << '\t' << e.etag << '\t' << e.last_modified
+		<< '\t' << e.size << '\t' << static_cast<long long>(e.mtime) << '\n';
+	}
+	if (!out.good())
+	    return false;
+    }
+
+    if (rename(tmp.c_str(), store.c_str()) != 0)
+	return false;
+    dirty = false;
+
+    return true;
+}
+
+
+bool validators::lookup(const std::string &url, entry *e)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(url);
+
+    if (it == entries.end())
+	return false;
+    *e = it->second;
+
+    return true;
+}
+
+
+void validators::record(const std::string &url, const std::string &filename,
+			const std::string &fullpath, const std::string &etag, const std::string &last_modified)
+{
+    entry e;
+    fileinfo local;
+
+    if (store.empty())
+	return;
+
+    bool usable = (!etag.empty() || !last_modified.empty())
+	&& fullpath.find_first_of("\t\n") == std::string::npos
+	&& url.find_first_of("\t\n") == std::string::npos
+	&& filename.find_first_of("\t\n") == std::string::npos
+	&& (local = fileops::lookup(fullpath)).regular;
+    e.size = local.size;
+    e.mtime = local.mtime;
+    e.filename = filename;
+    e.fullpath = fullpath;
+    e.etag = etag;
+    e.last_modified = last_modified;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (usable)
+	entries[url] = e;
+    else if (entries.erase(url) == 0)
+	return;
+    dirty = true;
+}
+
+
+bool validators::unchanged(const entry &e)
+{
+    // A journal means the file was left half done after it was recorded
+    if (fileops::file_exists(e.fullpath + JOURNAL_SUFFIX))
+	return false;
+
+    fileinfo local = fileops::lookup(e.fullpath);
+    return local.regular && local.size == e.size && local.mtime == e.mtime;
+}
+
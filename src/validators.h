@@ -0,0 +1,48 @@
+#ifndef VALIDATORS_H
+#define VALIDATORS_H
+
+#include <ctime>
+#include <string>
+
+/*
+ * Store of what the last run knew about every url it downloaded, for --sync.
+ * For each url it keeps the name the list asked for and the file it went
+ * into, the size and modification
+ * time the file was left with, and the ETag and Last-Modified the server
+ * sent for it. As long as the file is still like that, the next run can ask
+ * for it with a conditional GET instead of a header request, and a 304 means
+ * there's nothing to do.
+ *
+ * The store is read once at the start of the run and written back once at
+ * the end, as a text file with one tab separated line per url.
+ */
+namespace validators {
+    struct entry {
+	std::string filename;       // As given in the list, empty if none was
+	std::string fullpath;
+	std::string etag;           // Empty if the server didn't send one
+	std::string last_modified;
+	long long size = -1;        // Of the local file
+	time_t mtime = 0;           // Of the local file
+    };
+
+    /* Reads the store in file. A missing file is just an empty store */
+    void load(const std::string &file);
+    /* Writes the store back, if anything has changed since load() */
+    bool save();
+
+    /* Gets the entry for url. Returns false if there's none */
+    bool lookup(const std::string &url, entry *e);
+    /*
+     * Records the file at fullpath, asked for as filename, as the current
+     * version of url, with the
+     * size and modification time it has on disk now. Urls without an ETag
+     * or Last-Modified are forgotten, since there's nothing to ask with.
+     */
+    void record(const std::string &url, const std::string &filename,
+		const std::string &fullpath, const std::string &etag, const std::string &last_modified);
+    /* Whether the file in e is still the one e was recorded for */
+    bool unchanged(const entry &e);
+}
+
+#endif
@@ -0,0 +1,798 @@
+#include "writer.h"
+#include "digest.h"
+#include "journal.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <deque>
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Buffers are aligned to and sized in multiples of pages
+#define PAGE_SIZE 4096
+// Max number of writes queued at the same time, also the io_uring size
+#define MAX_JOBS 256
+// Number of threads when falling back on pwrite()
+#define PWRITE_THREADS 4
+// How much landed data to record in a sink's journal at a time
+#define JOURNAL_INTERVAL (4 * 1024 * 1024)
+
+
+/* One buffer queued for writing */
+struct job {
+    sink *owner;
+    int fd;
+    char *buf;
+    size_t cap;
+    size_t len;
+    size_t done;
+    long long offset;
+};
+
+/* Something that performs the writes of queued jobs and calls finish() */
+class backend {
+public:
+    virtual ~backend() {}
+    virtual void submit(job *j) = 0;
+};
+
+static void finish(job *j, bool ok);
+
+
+/*
+ * Writes with io_uring, talking to the kernel directly rather than through
+ * liburing. Jobs are submitted under a mutex from whichever thread fills a
+ * buffer, and a reaper thread waits for the completions.
+ */
+class uring_backend : public backend {
+public:
+    ~uring_backend();
+    bool setup();
+    void submit(job *j) override;
+
+private:
+    bool supports(uint8_t opcode);
+    bool push(uint8_t opcode, job *j);
+    void reap();
+
+    int ring_fd = -1;
+    void *sq_ptr = MAP_FAILED;
+    void *cq_ptr = MAP_FAILED;
+    size_t sq_len = 0;
+    size_t cq_len = 0;
+    io_uring_sqe *sqes = (io_uring_sqe *)MAP_FAILED;
+    size_t sqes_len = 0;
+
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    io_uring_cqe *cqes;
+
+    std::mutex submit_mtx;
+    unsigned unsubmitted = 0;  // On the queue but not taken by the kernel yet, guarded by submit_mtx
+    std::thread reaper;
+};
+
+
+bool uring_backend::setup()
+{
+    io_uring_params p;
+    memset(&p, 0, sizeof(p));
+
+    ring_fd = syscall(__NR_io_uring_setup, MAX_JOBS, &p);
+    if (ring_fd < 0)
+	return false;
+    // The ring is there from 5.1, but writes to a file only from 5.6
+    if (!supports(IORING_OP_WRITE))
+	return false;
+
+    sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_len = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+	sq_len = cq_len = std::max(sq_len, cq_len);
+
+    sq_ptr = mmap(nullptr, sq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		  ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ptr == MAP_FAILED)
+	return false;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+	cq_ptr = sq_ptr;
+    else {
+	cq_ptr = mmap(nullptr, cq_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		      ring_fd, IORING_OFF_CQ_RING);
+	if (cq_ptr == MAP_FAILED)
+	    return false;
+    }
+    sqes_len = p.sq_entries * sizeof(io_uring_sqe);
+    sqes = (io_uring_sqe *)mmap(nullptr, sqes_len, PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+	return false;
+
+    char *sq = (char *)sq_ptr;
+    char *cq = (char *)cq_ptr;
+    sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    sq_array = (unsigned *)(sq + p.sq_off.array);
+    cq_head = (unsigned *)(cq + p.cq_off.head);
+    cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    cqes = (io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    reaper = std::thread(&uring_backend::reap, this);
+    return true;
+}
+
+
+/*
+ * Whether the kernel does opcode. Kernels too old to tell don't do
+ * IORING_OP_WRITE either.
+ */
+bool uring_backend::supports(uint8_t opcode)
+{
+    size_t len = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+    io_uring_probe *probe = (io_uring_probe *)calloc(1, len);
+    bool ok = false;
+
+    if (!probe)
+	return false;
+    if (syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, 256) == 0)
+	ok = opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+
+    return ok;
+}
+
+
+uring_backend::~uring_backend()
+{
+    // A nop without a job tells the reaper to stop
+    if (reaper.joinable()) {
+	if (!push(IORING_OP_NOP, nullptr)) {
+	    // It can't be woken up, so leave it the ring and let the exit take both
+	    reaper.detach();
+	    return;
+	}
+	reaper.join();
+    }
+
+    if (sqes != MAP_FAILED)
+	munmap(sqes, sqes_len);
+    if (cq_ptr != MAP_FAILED && cq_ptr != sq_ptr)
+	munmap(cq_ptr, cq_len);
+    if (sq_ptr != MAP_FAILED)
+	munmap(sq_ptr, sq_len);
+    if (ring_fd >= 0)
+	close(ring_fd);
+}
+
+
+void uring_backend::submit(job *j)
+{
+    push(IORING_OP_WRITE, j);
+}
+
+
+/*
+ * Puts one request on the submission queue and tells the kernel about it.
+ * There's never more than MAX_JOBS jobs in flight, so the queue can't be
+ * full. Returns false if the kernel refused it, in which case its job and
+ * any others still waiting on the queue have been finished as failed.
+ */
+bool uring_backend::push(uint8_t opcode, job *j)
+{
+    std::vector<job *> refused;
+    std::unique_lock<std::mutex> lock(submit_mtx);
+
+    unsigned tail = *sq_tail;
+    unsigned index = tail & *sq_mask;
+    io_uring_sqe *sqe = &sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->user_data = (uint64_t)j;
+    if (j) {
+	sqe->fd = j->fd;
+	sqe->addr = (uint64_t)(j->buf + j->done);
+	sqe->len = j->len - j->done;
+	sqe->off = j->offset + j->done;
+    }
+    sq_array[index] = index;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+    unsubmitted++;
+
+    /*
+     * Entries the kernel didn't take on an earlier call are still on the
+     * queue, and go along with this one. A full completion queue clears
+     * once the reaper catches up.
+     */
+    while (unsubmitted > 0) {
+	long n = syscall(__NR_io_uring_enter, ring_fd, unsubmitted, 0, 0, nullptr, 0);
+	if (n > 0)
+	    unsubmitted -= n;
+	else if (n == 0 || errno == EAGAIN || errno == EBUSY)
+	    std::this_thread::yield();
+	else if (errno != EINTR)
+	    break;
+    }
+    if (unsubmitted == 0)
+	return true;
+
+    /*
+     * The kernel only reads the queue when we enter it, so what it didn't
+     * take can be taken back. Their sinks are waiting for them, so they're
+     * failed rather than left for a push that may never come.
+     */
+    tail = *sq_tail - unsubmitted;
+    for (unsigned i = tail; i != *sq_tail; i++)
+	refused.push_back((job *)sqes[sq_array[i & *sq_mask]].user_data);
+    __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+    unsubmitted = 0;
+    lock.unlock();
+
+    for (job *r : refused) {
+	if (r)
+	    finish(r, false);
+    }
+    return false;
+}
+
+
+/* Reaper thread. Finishes jobs, and resubmits the rest of short writes */
+void uring_backend::reap()
+{
+    bool stop = false;
+
+    while (!stop) {
+	// Interrupted, or woken up with nothing to do, is the same as an empty queue below
+	syscall(__NR_io_uring_enter, ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+	unsigned head = *cq_head;
+	unsigned tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+	for (; head != tail; head++) {
+	    io_uring_cqe *cqe = &cqes[head & *cq_mask];
+	    job *j = (job *)cqe->user_data;
+	    int res = cqe->res;
+
+	    if (!j) {
+		stop = true;
+		continue;
+	    }
+	    // Nothing was written, but trying again may well work
+	    if (res == -EINTR || res == -EAGAIN) {
+		submit(j);
+		continue;
+	    }
+	    if (res <= 0) {
+		finish(j, false);
+		continue;
+	    }
+	    j->done += res;
+	    if (j->done < j->len)
+		submit(j);
+	    else
+		finish(j, true);
+	}
+	__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    }
+}
+
+
+/* Writes with pwrite() on a few threads, for when io_uring isn't available */
+class pwrite_backend : public backend {
+public:
+    pwrite_backend();
+    ~pwrite_backend();
+    void submit(job *j) override;
+
+private:
+    void run();
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<job *> jobs;
+    bool stop = false;
+    std::vector<std::thread> threads;
+};
+
+
+pwrite_backend::pwrite_backend()
+{
+    for (int i = 0; i < PWRITE_THREADS; i++)
+	threads.emplace_back(&pwrite_backend::run, this);
+}
+
+
+pwrite_backend::~pwrite_backend()
+{
+    {
+	std::lock_guard<std::mutex> lock(mtx);
+	stop = true;
+    }
+    cv.notify_all();
+    for (std::thread &t : threads)
+	t.join();
+}
+
+
+void pwrite_backend::submit(job *j)
+{
+    {
+	std::lock_guard<std::mutex> lock(mtx);
+	jobs.push_back(j);
+    }
+    cv.notify_one();
+}
+
+
+void pwrite_backend::run()
+{
+    for (;;) {
+	job *j;
+	{
+	    std::unique_lock<std::mutex> lock(mtx);
+	    cv.wait(lock, [this] { return stop || !jobs.empty(); });
+	    if (jobs.empty())
+		return;
+	    j = jobs.front();
+	    jobs.pop_front();
+	}
+
+	bool ok = true;
+	while (ok && j->done < j->len) {
+	    ssize_t n = pwrite(j->fd, j->buf + j->done, j->len - j->done, j->offset + j->done);
+	    if (n <= 0)
+		ok = false;
+	    else
+		j->done += n;
+	}
+	finish(j, ok);
+    }
+}
+
+
+static backend *active_backend = nullptr;
+static size_t buffer_size = 1024 * 1024;
+
+// The buffer pool. Full sized buffers that have been written are kept for reuse
+static std::mutex pool_mtx;   // Guards everything down to waits
+static std::condition_variable pool_cv;
+static std::vector<char *> free_buffers;
+static size_t pool_limit = SIZE_MAX;
+static size_t in_use = 0;     // Bytes of buffers handed out
+static size_t cached = 0;     // Bytes of buffers in free_buffers
+static size_t peak = 0;       // Most bytes handed out at once
+static bool starved = false;  // Someone is waiting for a buffer
+static size_t waits = 0;      // Times a worker thread waited for a buffer
+
+// Transfers on the engine paused for a buffer, oldest first. Only used by the engine thread
+static std::deque<CURL *> paused;
+static size_t pauses = 0;
+static int wake_efd = -1;
+
+// Limit on the writes queued at once, which is what the io_uring has room for
+static std::mutex queue_mtx;
+static std::condition_variable queue_cv;
+static size_t queued_jobs = 0;
+
+
+/*
+ * Starts the write backend. Data is collected in buffers of
+ * buffer_size bytes before it's written, and at most memory_limit
+ * bytes of them are ever allocated.
+ */
+void writer::init(size_t size, size_t memory_limit)
+{
+    buffer_size = (size + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+    // Room for at least one full buffer, or nothing could ever be written
+    pool_limit = std::max(memory_limit, buffer_size);
+    wake_efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    uring_backend *uring = new uring_backend();
+    if (uring->setup())
+	active_backend = uring;
+    else {
+	delete uring;
+	active_backend = new pwrite_backend();
+    }
+}
+
+
+/* Stops the backend. All sinks must have been flushed */
+void writer::cleanup()
+{
+    delete active_backend;
+    active_backend = nullptr;
+
+    for (char *buf : free_buffers)
+	free(buf);
+    free_buffers.clear();
+    cached = 0;
+    paused.clear();
+    if (wake_efd >= 0)
+	close(wake_efd);
+    wake_efd = -1;
+}
+
+
+/* Logs how much of the pool was used at most, and how often transfers waited for it */
+void writer::report()
+{
+    std::lock_guard<std::mutex> lock(pool_mtx);
+    char used[32], limit[32];
+
+    if (peak == 0)
+	return;
+
+    snprintf(used, sizeof(used), "%.1fM", peak / (1024.0 * 1024.0));
+    snprintf(limit, sizeof(limit), "%.1fM", pool_limit / (1024.0 * 1024.0));
+    log(info[WRITE_INFO_POOL], {{"peak", used}, {"limit", limit},
+				{"pauses", static_cast<long long>(pauses)},
+				{"waits", static_cast<long long>(waits)}});
+}
+
+
+/* An eventfd that becomes readable when paused transfers can go on, for the engine's epoll set */
+int writer::wake_fd()
+{
+    return wake_efd;
+}
+
+
+/* Unpauses the transfers that were paused for a buffer, oldest first, while buffers last */
+void writer::wake()
+{
+    uint64_t count;
+    if (read(wake_efd, &count, sizeof(count)) < 0)
+	return;
+
+    while (!paused.empty()) {
+	CURL *curl = paused.front();
+	size_t before = pauses;
+	paused.pop_front();
+	// Hands the held back data to the write callback right away
+	curl_easy_pause(curl, CURLPAUSE_CONT);
+	// Paused again, so the buffers ran out and the rest have to keep waiting
+	if (pauses != before)
+	    break;
+    }
+}
+
+
+/* Drops curl from the paused transfers, once it's no longer on the engine */
+void writer::forget(CURL *curl)
+{
+    auto it = std::find(paused.begin(), paused.end(), curl);
+    if (it != paused.end())
+	paused.erase(it);
+}
+
+
+/*
+ * Gets a page aligned buffer of at least size bytes from the pool. If it
+ * would go over the limit, waits for buffers to come back when wait is
+ * set, or returns nullptr.
+ */
+static char *get_buffer(size_t size, size_t *cap, bool wait)
+{
+    *cap = (size + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+
+    std::unique_lock<std::mutex> lock(pool_mtx);
+    bool waited = false;
+    for (;;) {
+	if (*cap == buffer_size && !free_buffers.empty()) {
+	    char *buf = free_buffers.back();
+	    free_buffers.pop_back();
+	    cached -= buffer_size;
+	    in_use += buffer_size;
+	    peak = std::max(peak, in_use);
+	    return buf;
+	}
+
+	// Cached buffers of the wrong size make way for new ones
+	while (in_use + cached + *cap > pool_limit && !free_buffers.empty()) {
+	    free(free_buffers.back());
+	    free_buffers.pop_back();
+	    cached -= buffer_size;
+	}
+	if (in_use + cached + *cap <= pool_limit || in_use == 0)
+	    break;
+
+	starved = true;
+	if (!wait)
+	    return nullptr;
+	if (!waited)
+	    waits++;
+	waited = true;
+	pool_cv.wait(lock);
+    }
+    in_use += *cap;
+    peak = std::max(peak, in_use);
+    lock.unlock();
+
+    char *buf = (char *)aligned_alloc(PAGE_SIZE, *cap);
+    if (!buf) {
+	lock.lock();
+	in_use -= *cap;
+    }
+
+    return buf;
+}
+
+
+/* Returns a buffer from get_buffer() to the pool, and wakes whoever waits for one */
+static void put_buffer(char *buf, size_t cap)
+{
+    bool wake;
+
+    {
+	std::lock_guard<std::mutex> lock(pool_mtx);
+	in_use -= cap;
+	if (cap == buffer_size) {
+	    free_buffers.push_back(buf);
+	    cached += cap;
+	} else
+	    free(buf);
+	wake = starved;
+	starved = false;
+    }
+
+    if (wake) {
+	pool_cv.notify_all();
+	uint64_t one = 1;
+	if (wake_efd >= 0 && ::write(wake_efd, &one, sizeof(one)) < 0)
+	    return;
+    }
+}
+
+
+/* Hands a job to the backend, waiting if too many are queued already */
+static void queue_job(job *j)
+{
+    {
+	std::unique_lock<std::mutex> lock(queue_mtx);
+	queue_cv.wait(lock, [] { return queued_jobs < MAX_JOBS; });
+	queued_jobs++;
+    }
+
+    active_backend->submit(j);
+}
+
+
+/* Called by the backends when a job is done */
+static void finish(job *j, bool ok)
+{
+    sink *owner = j->owner;
+    long long at = j->offset;
+
+    {
+	std::lock_guard<std::mutex> lock(queue_mtx);
+	queued_jobs--;
+    }
+    queue_cv.notify_all();
+
+    put_buffer(j->buf, j->cap);
+    delete j;
+
+    // Last, since the sink may be gone as soon as it knows we're done
+    owner->complete(at, ok);
+}
+
+
+sink::sink(int fd, long long offset, long long expected, bool exact)
+    : fd(fd), start(offset), offset(offset),
+      limit(exact && expected >= 0 ? offset + expected : -1),
+      expected_end(expected >= 0 ? offset + expected : -1),
+      submitted(offset), recorded(offset)
+{
+}
+
+
+sink::~sink()
+{
+    if (buf)
+	put_buffer(buf, cap);
+    if (spare)
+	put_buffer(spare, spare_cap);
+}
+
+
+/*
+ * Queues len bytes to be written after the previous ones.
+ * Returns false if an earlier write has failed, or if exact was set and
+ * the data goes past the expected size.
+ */
+bool sink::write(const char *data, size_t len)
+{
+    if (limit >= 0 && offset + (long long)len > limit)
+	return false;
+
+    {
+	std::lock_guard<std::mutex> lock(mtx);
+	if (failed)
+	    return false;
+    }
+    if (hash)
+	hash->update(data, len);
+
+    while (len > 0) {
+	if (!buf && !take_buffer(true))
+	    return false;
+
+	size_t n = std::min(len, cap - used);
+	memcpy(buf + used, data, n);
+	used += n;
+	offset += n;
+	data += n;
+	len -= n;
+
+	if (used == cap)
+	    submit();
+    }
+
+    return true;
+}
+
+
+/*
+ * Makes sure there's room for len more bytes without waiting for the pool,
+ * taking the next buffer ahead of time if the current one is too full.
+ * Returns false if the pool has none to give. The current buffer is queued
+ * for writing then, so it comes back to the pool.
+ */
+bool sink::reserve(size_t len)
+{
+    size_t room = buf ? cap - used : 0;
+
+    if (room >= len || (spare && room + spare_cap >= len))
+	return true;
+    if (spare) {
+	put_buffer(spare, spare_cap);
+	spare = nullptr;
+    }
+
+    spare = get_buffer(next_size(offset + room, len - room), &spare_cap, false);
+    if (spare)
+	return true;
+
+    submit();
+    return false;
+}
+
+
+/* Makes the spare buffer the current one, or gets one from the pool. Returns false if there's none */
+bool sink::take_buffer(bool wait)
+{
+    if (spare) {
+	buf = spare;
+	cap = spare_cap;
+	spare = nullptr;
+	return true;
+    }
+
+    buf = get_buffer(next_size(offset, 0), &cap, wait);
+    return buf != nullptr;
+}
+
+
+/* Size of the buffer for data from offset at, at least min bytes */
+size_t sink::next_size(long long at, size_t min) const
+{
+    // Don't tie up a full buffer for what's left of a small file
+    size_t size = buffer_size;
+    if (expected_end > at && expected_end - at < (long long)buffer_size)
+	size = expected_end - at;
+
+    return std::max(size, min);
+}
+
+
+/* Queues the current buffer for writing */
+void sink::submit()
+{
+    if (!buf || used == 0)
+	return;
+
+    job *j = new job{this, fd, buf, cap, used, 0, offset - (long long)used};
+    buf = nullptr;
+    used = 0;
+
+    {
+	std::lock_guard<std::mutex> lock(mtx);
+	pending++;
+	inflight.insert(j->offset);
+	submitted = offset;
+    }
+
+    if (active_backend)
+	queue_job(j);
+    else {
+	// No backend running, so write it ourselves
+	bool ok = true;
+	while (ok && j->done < j->len) {
+	    ssize_t n = pwrite(j->fd, j->buf + j->done, j->len - j->done, j->offset + j->done);
+	    if (n <= 0)
+		ok = false;
+	    else
+		j->done += n;
+	}
+	long long at = j->offset;
+	put_buffer(j->buf, j->cap);
+	delete j;
+	complete(at, ok);
+    }
+}
+
+
+/* Writes out what's left and waits for all writes to land. Returns false if any failed */
+bool sink::flush()
+{
+    submit();
+
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this] { return pending == 0; });
+
+    return !failed;
+}
+
+
+/*
+ * Called by the backend when our write at offset at has finished. Records
+ * the data that has landed in the journal, if there's one and enough has
+ * landed since last time.
+ */
+void sink::complete(long long at, bool ok)
+{
+    long long landed = -1;
+
+    {
+	std::lock_guard<std::mutex> lock(mtx);
+	inflight.erase(inflight.find(at));
+	if (!ok)
+	    failed = true;
+	// Everything before the oldest unfinished write is on disk
+	long long end = inflight.empty() ? submitted : *inflight.begin();
+	if (jrnl && !failed && end - recorded >= JOURNAL_INTERVAL) {
+	    landed = end;
+	    recorded = end;
+	}
+    }
+
+    // Before pending drops, since the sink may be gone as soon as it's 0
+    if (landed >= 0)
+	jrnl->checkpoint(start, landed);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    pending--;
+    cv.notify_all();
+}
+
+
+/* Custom callback function for CURLOPT_WRITEFUNCTION, with the sink in CURLOPT_WRITEDATA */
+size_t sink::write_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    sink *s = static_cast<sink *>(userdata);
+
+    // Wait for a buffer on the engine's time rather than holding it up
+    if (s->pause_curl && !s->reserve(size * nmemb)) {
+	paused.push_back(s->pause_curl);
+	pauses++;
+	return CURL_WRITEFUNC_PAUSE;
+    }
+    if (!s->write(ptr, size * nmemb))
+	return 0;
+
+    return size * nmemb;
+}
@@ -0,0 +1,122 @@
+#ifndef WRITER_H
+#define WRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <curl/curl.h>
+#include <mutex>
+#include <set>
+
+class journal;
+namespace digest { class hasher; }
+
+/*
+ * Asynchronous file writes. Transfers hand their data to a sink, which
+ * collects it into large page aligned buffers and queues every full buffer
+ * to be written in the background. The writes go through io_uring, or a
+ * small pool of pwrite() threads where io_uring isn't available.
+ *
+ * All buffers come from one pool, which never holds more than memory_limit
+ * bytes, however many transfers there are. Written buffers go back to the
+ * pool and are reused. When it runs dry, transfers on the event engine are
+ * paused with CURL_WRITEFUNC_PAUSE until buffers come back, and woken by
+ * the engine through wake_fd() and wake(). Transfers on worker threads wait
+ * in their write callback instead. Either way a fast network can't outrun
+ * a slow disk by more than the limit.
+ */
+namespace writer {
+    /*
+     * Starts the write backend. Data is collected in buffers of
+     * buffer_size bytes before it's written, and at most memory_limit
+     * bytes of them are ever allocated.
+     */
+    void init(size_t buffer_size, size_t memory_limit);
+    /* Stops the backend. All sinks must have been flushed */
+    void cleanup();
+    /* Logs how much of the pool was used at most, and how often transfers waited for it */
+    void report();
+
+    /* An eventfd that becomes readable when paused transfers can go on, for the engine's epoll set */
+    int wake_fd();
+    /* Unpauses the transfers that were paused for a buffer, oldest first, while buffers last */
+    void wake();
+    /* Drops curl from the paused transfers, once it's no longer on the engine */
+    void forget(CURL *curl);
+}
+
+/*
+ * Writes the data of one transfer to a file descriptor, starting at a given
+ * offset. The sink doesn't own the file descriptor, but it must stay open
+ * until flush() has returned.
+ */
+class sink {
+public:
+    /*
+     * expected is how many bytes are expected, or -1 if unknown, and is
+     * used to size the buffers of small files. If exact is set, receiving
+     * more than that is an error.
+     */
+    sink(int fd, long long offset, long long expected = -1, bool exact = false);
+    ~sink();
+
+    /*
+     * Queues len bytes to be written after the previous ones.
+     * Returns false if an earlier write has failed, or if exact was set and
+     * the data goes past the expected size.
+     */
+    bool write(const char *data, size_t len);
+    /* Writes out what's left and waits for all writes to land. Returns false if any failed */
+    bool flush();
+    /* File offset the sink started writing at */
+    long long get_start() const { return start; }
+    /* File offset right after the last byte accepted by write() */
+    long long get_offset() const { return offset; }
+    /*
+     * Records the data in j as it lands, every JOURNAL_INTERVAL bytes, so
+     * an interrupted download can be resumed from there.
+     */
+    void set_journal(journal *j) { jrnl = j; }
+    /* Hashes the data with h as it's accepted by write() */
+    void set_hasher(digest::hasher *h) { hash = h; }
+    /*
+     * Lets write_callback() pause curl when the pool has no buffer for the
+     * data, instead of waiting for one. For transfers on the event engine.
+     */
+    void set_pause(CURL *curl) { pause_curl = curl; }
+
+    /* Custom callback function for CURLOPT_WRITEFUNCTION, with the sink in CURLOPT_WRITEDATA */
+    static size_t write_callback(char *ptr, size_t size, size_t nmemb, void *userdata);
+
+    /* Called by the backend when our write at offset has finished */
+    void complete(long long at, bool ok);
+
+private:
+    bool reserve(size_t len);
+    bool take_buffer(bool wait);
+    size_t next_size(long long at, size_t min) const;
+    void submit();
+
+    int fd;
+    long long start;  // Offset of the first byte
+    long long offset;
+    long long limit;  // Offset the data may not go past, -1 for none
+    long long expected_end;
+    char *buf = nullptr;
+    size_t cap = 0;
+    size_t used = 0;
+    char *spare = nullptr;  // Next buffer, taken ahead by reserve()
+    size_t spare_cap = 0;
+    CURL *pause_curl = nullptr;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_t pending = 0;  // Writes queued but not finished
+    bool failed = false;
+    std::multiset<long long> inflight;  // Offsets of the writes queued but not finished
+    long long submitted;  // End of the data queued for writing
+    journal *jrnl = nullptr;
+    digest::hasher *hash = nullptr;
+    long long recorded;   // End of the data last recorded in jrnl
+};
+
+#endif
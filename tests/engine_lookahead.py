@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+Checks that the event engine (-e) reads past a long run of urls for one
+host that's at its --host-connections limit, and gets on with the other
+hosts listed after it instead of leaving its free transfers idle.
+
+The list starts with more urls for a slow host than the queue holds, then
+has a few for a fast one. Within a few seconds, the fast ones should all
+be done while the slow host is still being worked through two at a time.
+Exits with 1 if they aren't.
+
+    tests/engine_lookahead.py [--curler ./curler]
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "bench"))
+
+from common import start_server  # noqa: E402
+
+SLOW_FILES = 5000  # More than the queue holds (QUEUE_DEPTH in src/main.cpp)
+FAST_FILES = 50
+RUN_SECONDS = 5
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--curler", default=os.path.join(HERE, "..", "curler"))
+    args = parser.parse_args()
+
+    slow, slow_port = start_server("--delay-every", "1", "--delay-ms", "100")
+    fast, fast_port = start_server()
+    tmp = tempfile.mkdtemp(prefix="curler-test-")
+    try:
+        urls = os.path.join(tmp, "urls.txt")
+        outdir = os.path.join(tmp, "out")
+        os.makedirs(outdir)
+        # 127.0.0.1 and localhost count as different hosts
+        with open(urls, "w") as f:
+            for i in range(SLOW_FILES):
+                f.write("http://127.0.0.1:%d/1024/slow%d.bin\n" % (slow_port, i))
+            for i in range(FAST_FILES):
+                f.write("http://localhost:%d/1024/fast%d.bin\n" % (fast_port, i))
+
+        proc = subprocess.Popen([args.curler, "-e", "16", "-n", "--host-connections", "2",
+                                 "-p", outdir, "-f", urls], stdout=subprocess.DEVNULL)
+        time.sleep(RUN_SECONDS)
+        proc.terminate()
+        proc.wait()
+
+        done = sum(1 for name in os.listdir(outdir)
+                   if name.startswith("fast") and os.path.getsize(os.path.join(outdir, name)) == 1024)
+        print("fast host: %d of %d downloaded" % (done, FAST_FILES))
+        return 0 if done == FAST_FILES else 1
+    finally:
+        slow.terminate()
+        fast.terminate()
+        shutil.rmtree(tmp, ignore_errors=True)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+Generates src/mimetypes.h from src/mimetypes.in.
+
+Both directions (type -> extension and extension -> type) become a
+constexpr perfect hash table: a key is hashed once to pick a bucket, and
+the bucket's seed is hashed in to pick the one slot the key can be in.
+The hash here must match mimetypes::hash() in the generated header.
+
+    tools/gen_mimetypes.py src/mimetypes.in > src/mimetypes.h
+"""
+
+import sys
+
+MASK = 0xFFFFFFFF
+
+
+def fmix(h):
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK
+    h ^= h >> 16
+    return h
+
+
+def hash_key(key, seed):
+    """FNV-1a followed by the murmur3 finalizer, in 32 bits."""
+    h = (2166136261 ^ seed) & MASK
+    for c in key.encode():
+        h ^= c
+        h = (h * 16777619) & MASK
+    return fmix(h)
+
+
+def build(pairs):
+    """Returns (seeds, slots) for a perfect hash of the keys of pairs."""
+    size = 1
+    while size < len(pairs):
+        size *= 2
+    nbuckets = size // 4
+
+    buckets = [[] for _ in range(nbuckets)]
+    for key, value in pairs:
+        buckets[hash_key(key, 0) % nbuckets].append((key, value))
+
+    seeds = [0] * nbuckets
+    slots = [None] * size
+    # Place the largest buckets first, while there's still room
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            taken = [hash_key(k, seed) % size for k, _ in buckets[b]]
+            if len(set(taken)) == len(taken) and all(slots[t] is None for t in taken):
+                break
+            seed += 1
+            if seed > 0xFFFF:
+                sys.exit("gen_mimetypes: no seed found, table too full")
+        seeds[b] = seed
+        for t, pair in zip(taken, buckets[b]):
+            slots[t] = pair
+
+    return seeds, slots
+
+
+def emit_table(name, seeds, slots):
+    out = []
+    out.append("    inline constexpr uint16_t %s_seeds[] = {" % name)
+    for i in range(0, len(seeds), 12):
+        out.append("        " + ", ".join(str(s) for s in seeds[i:i + 12]) + ",")
+    out.append("    };")
+    out.append("")
+    out.append("    inline constexpr entry %s_slots[] = {" % name)
+    for slot in slots:
+        if slot is None:
+            out.append("        {\"\", \"\"},")
+        else:
+            out.append("        {\"%s\", \"%s\"}," % slot)
+    out.append("    };")
+    return out
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: gen_mimetypes.py <mimetypes.in>")
+
+    types, exts = [], []
+    seen_types, seen_exts = set(), set()
+    with open(sys.argv[1]) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if not line or line.startswith("#"):
+                continue
+            mimetype, ext = line.split("\t")
+            if mimetype not in seen_types:
+                seen_types.add(mimetype)
+                types.append((mimetype, ext))
+            if ext not in seen_exts:
+                seen_exts.add(ext)
+                exts.append((ext, mimetype))
+
+    type_seeds, type_slots = build(types)
+    ext_seeds, ext_slots = build(exts)
+
+    out = [
+        "/* Generated by tools/gen_mimetypes.py from src/mimetypes.in. Don't edit. */",
+        "#ifndef MIMETYPES_H",
+        "#define MIMETYPES_H",
+        "",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "",
+        "/*",
+        " * Mimetypes and their file extensions, as constexpr perfect hash tables.",
+        " * There's nothing to set up at startup, and a lookup is one hash and one",
+        " * string compare.",
+        " */",
+        "namespace mimetypes {",
+        "    struct entry {",
+        "        std::string_view key;",
+        "        std::string_view value;",
+        "    };",
+        "",
+        "    constexpr uint32_t hash(std::string_view key, uint32_t seed)",
+        "    {",
+        "        uint32_t h = 2166136261u ^ seed;",
+        "        for (char c : key) {",
+        "            h ^= static_cast<unsigned char>(c);",
+        "            h *= 16777619u;",
+        "        }",
+        "        h ^= h >> 16;",
+        "        h *= 0x85ebca6bu;",
+        "        h ^= h >> 13;",
+        "        h *= 0xc2b2ae35u;",
+        "        h ^= h >> 16;",
+        "        return h;",
+        "    }",
+        "",
+    ]
+    out += emit_table("type", type_seeds, type_slots)
+    out.append("")
+    out += emit_table("ext", ext_seeds, ext_slots)
+    out += [
+        "",
+        "    template <size_t B, size_t N>",
+        "    constexpr std::string_view find(const uint16_t (&seeds)[B], const entry (&slots)[N],",
+        "                                    std::string_view key)",
+        "    {",
+        "        const entry &e = slots[hash(key, seeds[hash(key, 0) % B]) % N];",
+        "        return e.key == key ? e.value : std::string_view();",
+        "    }",
+        "",
+        "    /* File extension for a lowercase mimetype, or empty if unknown */",
+        "    constexpr std::string_view extension(std::string_view type)",
+        "    {",
+        "        return find(type_seeds, type_slots, type);",
+        "    }",
+        "",
+        "    /* Mimetype for a file extension (with the dot), or empty if unknown */",
+        "    constexpr std::string_view type(std::string_view extension)",
+        "    {",
+        "        return find(ext_seeds, ext_slots, extension);",
+        "    }",
+        "}",
+        "",
+        "#endif",
+    ]
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()